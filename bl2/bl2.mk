@@ -54,6 +54,10 @@ ifeq (${ENABLE_PMF},1)
 BL2_SOURCES		+=	lib/pmf/pmf_main.c
 endif
 
+ifeq (${BOOT_TIME_INSTRUMENTATION},1)
+BL2_SOURCES		+=	lib/pmf/pmf_boot_time.c
+endif
+
 bl31pre: # Make an empty bl31.bin.o because it is linked in on all targets
 	$(Q)(cd $(BUILD_PLAT) ; $(LD) -r -b binary -o bl31.bin.o /dev/null)
 
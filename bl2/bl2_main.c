@@ -16,6 +16,7 @@
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/console.h>
 #include <drivers/fwu/fwu.h>
+#include <lib/boot_time.h>
 #include <lib/bootmarker_capture.h>
 #include <lib/extensions/pauth.h>
 #include <lib/pmf/pmf.h>
@@ -91,6 +92,7 @@ void bl2_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_ENTRY, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIME_CAPTURE(BOOT_TIME_BL2_ENTRY);
 
 	NOTICE("BL2: %s\n", version_string);
 	NOTICE("BL2: %s\n", build_message);
@@ -139,6 +141,8 @@ void bl2_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_EXIT, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIME_CAPTURE(BOOT_TIME_BL2_EXIT);
+	boot_time_export();
 
 	console_flush();
 
@@ -155,6 +159,8 @@ void bl2_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_EXIT, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIME_CAPTURE(BOOT_TIME_BL2_EXIT);
+	boot_time_export();
 	console_flush();
 
 #if ENABLE_PAUTH
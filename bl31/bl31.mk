@@ -58,6 +58,10 @@ ifeq (${ENABLE_PMF}, 1)
 BL31_SOURCES		+=	lib/pmf/pmf_main.c
 endif
 
+ifeq (${BOOT_TIME_INSTRUMENTATION}, 1)
+BL31_SOURCES		+=	lib/pmf/pmf_boot_time.c
+endif
+
 include lib/debugfs/debugfs.mk
 ifeq (${USE_DEBUGFS},1)
 	BL31_SOURCES	+= $(DEBUGFS_SRCS)
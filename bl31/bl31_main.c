@@ -17,6 +17,7 @@
 #include <common/feat_detect.h>
 #include <common/runtime_svc.h>
 #include <drivers/console.h>
+#include <lib/boot_time.h>
 #include <lib/bootmarker_capture.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/pmf/pmf.h>
@@ -132,6 +133,7 @@ void bl31_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL31_ENTRY, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIME_CAPTURE(BOOT_TIME_BL31_ENTRY);
 
 #ifdef SUPPORT_UNKNOWN_MPID
 	if (unsupported_mpid_flag == 0) {
@@ -216,6 +218,7 @@ void bl31_main(void)
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL31_EXIT, PMF_CACHE_MAINT);
 	console_flush();
 #endif
+	BOOT_TIME_CAPTURE(BOOT_TIME_BL31_EXIT);
 }
 
 /*******************************************************************************
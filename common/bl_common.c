@@ -15,6 +15,7 @@
 #include <common/debug.h>
 #include <drivers/auth/auth_mod.h>
 #include <drivers/io/io_storage.h>
+#include <lib/boot_time.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
@@ -82,6 +83,8 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 
 	image_base = image_data->image_base;
 
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_LOAD_START);
+
 	/* Obtain a reference to the image by querying the platform layer */
 	io_result = plat_get_image_source(image_id, &dev_handle, &image_spec);
 	if (io_result != 0) {
@@ -132,6 +135,9 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 	INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", image_id, image_base,
 	     (uintptr_t)(image_base + image_size));
 
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_LOAD_END);
+	boot_time_set_img_bytes(image_id, image_size);
+
 exit:
 	(void)io_close(image_handle);
 	/* Ignore improbable/unrecoverable error in 'close' */
@@ -171,9 +177,11 @@ static int load_auth_image_recursive(unsigned int image_id,
 	}
 
 	/* Authenticate it */
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_AUTH_START);
 	rc = auth_mod_verify_img(image_id,
 				 (void *)image_data->image_base,
 				 image_data->image_size);
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_AUTH_END);
 	if (rc != 0) {
 		/* Authentication error, zero memory and flush it right away. */
 		zero_normalmem((void *)image_data->image_base,
@@ -14,6 +14,7 @@
  * that.
  */
 
+#include <assert.h>
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
@@ -25,10 +26,583 @@
 #include <common/fdt_fixup.h>
 #include <common/fdt_wrappers.h>
 #include <drivers/console.h>
+#include <lib/cassert.h>
 #include <lib/psci/psci.h>
 #include <plat/common/platform.h>
 
 
+#define FIXUP_ALIGN(x)	(((x) + FDT_TAGSIZE - 1U) & ~(FDT_TAGSIZE - 1U))
+
+/* Types of splices, places where the structure block is changed */
+#define FIXUP_REPLACE	0U	/* replace a property */
+#define FIXUP_PROPS	1U	/* add properties to a node */
+#define FIXUP_NODES	2U	/* add subnodes to a node */
+
+CASSERT(FDT_FIXUP_DATA_SIZE <= 0x10000U, assert_fdt_fixup_data_size);
+
+/*
+ * Fixup transactions. Each libfdt edit moves the whole end of the blob. The
+ * fdt_fixup_*() functions only record the nodes and properties to add or
+ * replace, and fdt_fixup_commit() applies all of them in one pass, in which
+ * each part of the blob is moved once.
+ *
+ * Nodes of the DTB are referred to by their offset, which stays valid since
+ * the DTB is not changed until the commit. Added nodes get a handle past the
+ * end of the blob. Lookups in the DTB do not see the pending edits, and the
+ * DTB must not be changed by other means before the commit.
+ */
+static bool fixup_is_new(const struct fdt_fixup *fix, int node)
+{
+	return node >= fix->new_node_base;
+}
+
+static int fixup_error(struct fdt_fixup *fix, int err)
+{
+	if (fix->err == 0) {
+		fix->err = err;
+	}
+
+	return err;
+}
+
+static int fixup_copy(struct fdt_fixup *fix, const void *src, size_t len,
+		      uint16_t *off)
+{
+	if (len > (FDT_FIXUP_DATA_SIZE - fix->data_used)) {
+		return fixup_error(fix, -FDT_ERR_NOSPACE);
+	}
+
+	(void)memcpy(&fix->data[fix->data_used], src, len);
+	*off = (uint16_t)fix->data_used;
+	fix->data_used += len;
+
+	return 0;
+}
+
+static int fixup_check_node(struct fdt_fixup *fix, int node)
+{
+	if (fixup_is_new(fix, node)) {
+		if ((unsigned int)(node - fix->new_node_base) >=
+		    fix->num_nodes) {
+			return fixup_error(fix, -FDT_ERR_BADOFFSET);
+		}
+	} else if (fdt_get_name(fix->dtb, node, NULL) == NULL) {
+		return fixup_error(fix, -FDT_ERR_BADOFFSET);
+	}
+
+	return 0;
+}
+
+void fdt_fixup_init(struct fdt_fixup *fix, void *dtb)
+{
+	fix->dtb = dtb;
+	fix->err = fdt_check_header(dtb);
+	fix->new_node_base = (fix->err == 0) ? (int)fdt_totalsize(dtb) : 0;
+	fix->num_nodes = 0U;
+	fix->num_props = 0U;
+	fix->data_used = 0U;
+}
+
+/*
+ * Add a node named 'name' under 'parent', an existing node or one added
+ * before. Adding the same node again returns the same handle, so that several
+ * fixups can share it. Returns the handle of the node, or a negative libfdt
+ * error value, which is also returned by fdt_fixup_commit().
+ */
+int fdt_fixup_add_subnode(struct fdt_fixup *fix, int parent, const char *name)
+{
+	struct fdt_fixup_node *node;
+	unsigned int i;
+	int ret;
+
+	if (fix->err != 0) {
+		return fix->err;
+	}
+
+	ret = fixup_check_node(fix, parent);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (i = 0U; i < fix->num_nodes; i++) {
+		if ((fix->node[i].parent == parent) &&
+		    (strcmp(&fix->data[fix->node[i].name], name) == 0)) {
+			return fix->new_node_base + (int)i;
+		}
+	}
+
+	if (!fixup_is_new(fix, parent)) {
+		ret = fdt_subnode_offset(fix->dtb, parent, name);
+		if (ret >= 0) {
+			return fixup_error(fix, -FDT_ERR_EXISTS);
+		}
+
+		if (ret != -FDT_ERR_NOTFOUND) {
+			return fixup_error(fix, ret);
+		}
+	}
+
+	if (fix->num_nodes == FDT_FIXUP_MAX_NODES) {
+		return fixup_error(fix, -FDT_ERR_NOSPACE);
+	}
+
+	node = &fix->node[fix->num_nodes];
+	ret = fixup_copy(fix, name, strlen(name) + 1U, &node->name);
+	if (ret < 0) {
+		return ret;
+	}
+
+	node->parent = parent;
+
+	return fix->new_node_base + (int)fix->num_nodes++;
+}
+
+/*
+ * Set property 'name' of 'node', an existing node or one added before, to the
+ * 'len' bytes at 'val'. Returns 0, or a negative libfdt error value which is
+ * also returned by fdt_fixup_commit().
+ */
+int fdt_fixup_setprop(struct fdt_fixup *fix, int node, const char *name,
+		      const void *val, unsigned int len)
+{
+	struct fdt_fixup_prop *prop = NULL;
+	unsigned int i;
+	int ret;
+
+	if (fix->err != 0) {
+		return fix->err;
+	}
+
+	ret = fixup_check_node(fix, node);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (len > UINT16_MAX) {
+		return fixup_error(fix, -FDT_ERR_BADVALUE);
+	}
+
+	/* The last value set for a property wins */
+	for (i = 0U; i < fix->num_props; i++) {
+		if ((fix->prop[i].node == node) &&
+		    (strcmp(&fix->data[fix->prop[i].name], name) == 0)) {
+			prop = &fix->prop[i];
+			break;
+		}
+	}
+
+	if (prop == NULL) {
+		if (fix->num_props == FDT_FIXUP_MAX_PROPS) {
+			return fixup_error(fix, -FDT_ERR_NOSPACE);
+		}
+
+		prop = &fix->prop[fix->num_props];
+		ret = fixup_copy(fix, name, strlen(name) + 1U, &prop->name);
+		if (ret < 0) {
+			return ret;
+		}
+
+		prop->node = node;
+		fix->num_props++;
+	}
+
+	ret = fixup_copy(fix, val, len, &prop->val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	prop->len = (uint16_t)len;
+
+	return 0;
+}
+
+int fdt_fixup_setprop_u32(struct fdt_fixup *fix, int node, const char *name,
+			  uint32_t val)
+{
+	fdt32_t tmp = cpu_to_fdt32(val);
+
+	return fdt_fixup_setprop(fix, node, name, &tmp, sizeof(tmp));
+}
+
+int fdt_fixup_setprop_string(struct fdt_fixup *fix, int node,
+			     const char *name, const char *str)
+{
+	return fdt_fixup_setprop(fix, node, name, str, strlen(str) + 1U);
+}
+
+/*
+ * Write property 'i' at 'dst', or only compute its size if 'dst' is NULL.
+ * The helpers below follow the same convention.
+ */
+static int fixup_emit_prop(const struct fdt_fixup *fix, unsigned int i,
+			   char *dst)
+{
+	const struct fdt_fixup_prop *prop = &fix->prop[i];
+	struct fdt_property *p = (struct fdt_property *)dst;
+
+	if (p != NULL) {
+		p->tag = cpu_to_fdt32(FDT_PROP);
+		p->len = cpu_to_fdt32(prop->len);
+		p->nameoff = cpu_to_fdt32(prop->nameoff);
+		(void)memcpy(p->data, &fix->data[prop->val], prop->len);
+		(void)memset(p->data + prop->len, 0,
+			     FIXUP_ALIGN(prop->len) - prop->len);
+	}
+
+	return (int)(sizeof(struct fdt_property) + FIXUP_ALIGN(prop->len));
+}
+
+static char *fixup_at(char *dst, int off)
+{
+	return (dst != NULL) ? (dst + off) : NULL;
+}
+
+static int fixup_emit_node(const struct fdt_fixup *fix, unsigned int i,
+			   char *dst);
+
+/*
+ * Properties or subnodes to add to 'node'. Like libfdt, which inserts them
+ * before the previous ones, put the last added first, so that the result is
+ * the same as with separate libfdt calls.
+ */
+static int fixup_emit_contents(const struct fdt_fixup *fix, int node,
+			       unsigned int type, char *dst)
+{
+	unsigned int i;
+	int size = 0;
+
+	if (type == FIXUP_PROPS) {
+		for (i = fix->num_props; i-- > 0U;) {
+			if ((fix->prop[i].node == node) &&
+			    !fix->prop[i].exists) {
+				size += fixup_emit_prop(fix, i,
+							fixup_at(dst, size));
+			}
+		}
+
+		return size;
+	}
+
+	for (i = fix->num_nodes; i-- > 0U;) {
+		if (fix->node[i].parent == node) {
+			size += fixup_emit_node(fix, i, fixup_at(dst, size));
+		}
+	}
+
+	return size;
+}
+
+static int fixup_emit_node(const struct fdt_fixup *fix, unsigned int i,
+			   char *dst)
+{
+	const char *name = &fix->data[fix->node[i].name];
+	size_t name_len = strlen(name) + 1U;
+	int size = (int)(FDT_TAGSIZE + FIXUP_ALIGN(name_len));
+
+	if (dst != NULL) {
+		*(fdt32_t *)dst = cpu_to_fdt32(FDT_BEGIN_NODE);
+		(void)memset(dst + FDT_TAGSIZE, 0, FIXUP_ALIGN(name_len));
+		(void)memcpy(dst + FDT_TAGSIZE, name, name_len);
+	}
+
+	size += fixup_emit_contents(fix, fix->new_node_base + (int)i,
+				    FIXUP_PROPS, fixup_at(dst, size));
+	size += fixup_emit_contents(fix, fix->new_node_base + (int)i,
+				    FIXUP_NODES, fixup_at(dst, size));
+
+	if (dst != NULL) {
+		*(fdt32_t *)(dst + size) = cpu_to_fdt32(FDT_END_NODE);
+	}
+
+	return size + (int)FDT_TAGSIZE;
+}
+
+/*
+ * A replaced property which does not grow is padded with FDT_NOP tags, so
+ * that no splice shrinks the blob.
+ */
+static int fixup_emit_splice(const struct fdt_fixup *fix,
+			     const struct fdt_fixup_splice *s, char *dst)
+{
+	int size;
+
+	if (s->type != FIXUP_REPLACE) {
+		return fixup_emit_contents(fix, s->node, s->type, dst);
+	}
+
+	size = fixup_emit_prop(fix, (unsigned int)s->node, dst);
+	for (; size < s->old_size; size += (int)FDT_TAGSIZE) {
+		if (dst != NULL) {
+			*(fdt32_t *)(dst + size) = cpu_to_fdt32(FDT_NOP);
+		}
+	}
+
+	return size;
+}
+
+static void fixup_add_splice(struct fdt_fixup *fix, unsigned int *num,
+			     int pos, int old_size, int node, unsigned int type)
+{
+	struct fdt_fixup_splice *s;
+	unsigned int i;
+
+	for (i = 0U; i < *num; i++) {
+		if ((fix->splice[i].type == type) &&
+		    (fix->splice[i].node == node)) {
+			return;
+		}
+	}
+
+	/*
+	 * Keep them sorted by position, insertions before a replaced property
+	 * at the same place.
+	 */
+	for (i = *num; i > 0U; i--) {
+		s = &fix->splice[i - 1U];
+		if ((s->pos < pos) ||
+		    ((s->pos == pos) && (s->old_size <= old_size))) {
+			break;
+		}
+
+		fix->splice[i] = *s;
+	}
+
+	s = &fix->splice[i];
+	s->pos = pos;
+	s->old_size = old_size;
+	s->node = node;
+	s->type = type;
+	(*num)++;
+}
+
+/*
+ * Offset in the structure block where libfdt would add properties (right after
+ * the node name) or subnodes (after the properties) to 'node'.
+ */
+static int fixup_insert_pos(const void *dtb, int node, unsigned int type)
+{
+	uint32_t tag;
+	int offs, next;
+
+	(void)fdt_next_tag(dtb, node, &next);
+	if (type == FIXUP_PROPS) {
+		return next;
+	}
+
+	do {
+		offs = next;
+		tag = fdt_next_tag(dtb, offs, &next);
+	} while ((tag == FDT_PROP) || (tag == FDT_NOP));
+
+	return (next < 0) ? next : offs;
+}
+
+/* Find property 'name' of 'node' and its size in the structure block */
+static int fixup_find_prop(const void *dtb, int node, const char *name,
+			   int *size)
+{
+	const char *pname;
+	int offs, len;
+
+	fdt_for_each_property_offset(offs, dtb, node) {
+		(void)fdt_getprop_by_offset(dtb, offs, &pname, &len);
+		if ((pname != NULL) && (strcmp(pname, name) == 0)) {
+			*size = (int)(sizeof(struct fdt_property) +
+				      FIXUP_ALIGN((unsigned int)len));
+			return offs;
+		}
+	}
+
+	return offs;
+}
+
+/*
+ * Offset of 'name' in the strings block of the DTB, 'strings_size' bytes long,
+ * or in the names added by earlier properties, placed right after it.
+ */
+static uint32_t fixup_string(struct fdt_fixup *fix, unsigned int i,
+			     int strings_size, int *new_size)
+{
+	const char *strtab = (const char *)fix->dtb +
+			     fdt_off_dt_strings(fix->dtb);
+	const char *name = &fix->data[fix->prop[i].name];
+	size_t len = strlen(name) + 1U;
+	unsigned int j;
+	int offs;
+
+	/* Like libfdt, reuse the end of a longer name */
+	for (offs = 0; (offs + (int)len) <= strings_size; offs++) {
+		if (memcmp(strtab + offs, name, len) == 0) {
+			return (uint32_t)offs;
+		}
+	}
+
+	for (j = 0U; j < i; j++) {
+		if ((fix->prop[j].nameoff >= (uint32_t)strings_size) &&
+		    (strcmp(&fix->data[fix->prop[j].name], name) == 0)) {
+			return fix->prop[j].nameoff;
+		}
+	}
+
+	offs = strings_size + *new_size;
+	*new_size += (int)len;
+
+	return (uint32_t)offs;
+}
+
+static int fixup_apply(struct fdt_fixup *fix)
+{
+	char *dtb = fix->dtb;
+	char *strtab, *dt_struct;
+	const char *name;
+	struct fdt_fixup_splice *s;
+	unsigned int i, num = 0U;
+	int strings_size, new_strings = 0, grow = 0;
+	int end, shift, offs, size, ret;
+
+	if ((fix->num_props == 0U) && (fix->num_nodes == 0U)) {
+		return 0;
+	}
+
+	/* Have the strings block right after the structure block */
+	if ((fdt_version(dtb) < 17) ||
+	    (fdt_off_mem_rsvmap(dtb) > fdt_off_dt_struct(dtb)) ||
+	    (fdt_off_dt_strings(dtb) !=
+	     (fdt_off_dt_struct(dtb) + fdt_size_dt_struct(dtb)))) {
+		ret = fdt_open_into(dtb, dtb, (int)fdt_totalsize(dtb));
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	strings_size = (int)fdt_size_dt_strings(dtb);
+
+	for (i = 0U; i < fix->num_props; i++) {
+		fix->prop[i].exists = false;
+		fix->prop[i].nameoff = fixup_string(fix, i, strings_size,
+						    &new_strings);
+
+		if (fixup_is_new(fix, fix->prop[i].node)) {
+			continue;
+		}
+
+		offs = fixup_find_prop(dtb, fix->prop[i].node,
+				       &fix->data[fix->prop[i].name], &size);
+		if (offs >= 0) {
+			fix->prop[i].exists = true;
+			fixup_add_splice(fix, &num, offs, size, (int)i,
+					 FIXUP_REPLACE);
+		} else if (offs == -FDT_ERR_NOTFOUND) {
+			offs = fixup_insert_pos(dtb, fix->prop[i].node,
+						FIXUP_PROPS);
+			if (offs < 0) {
+				return offs;
+			}
+
+			fixup_add_splice(fix, &num, offs, 0, fix->prop[i].node,
+					 FIXUP_PROPS);
+		} else {
+			return offs;
+		}
+	}
+
+	for (i = 0U; i < fix->num_nodes; i++) {
+		if (fixup_is_new(fix, fix->node[i].parent)) {
+			continue;
+		}
+
+		offs = fixup_insert_pos(dtb, fix->node[i].parent, FIXUP_NODES);
+		if (offs < 0) {
+			return offs;
+		}
+
+		fixup_add_splice(fix, &num, offs, 0, fix->node[i].parent,
+				 FIXUP_NODES);
+	}
+
+	for (i = 0U; i < num; i++) {
+		s = &fix->splice[i];
+		grow += fixup_emit_splice(fix, s, NULL) - s->old_size;
+	}
+
+	if ((fdt_off_dt_strings(dtb) + grow + strings_size + new_strings) >
+	    fdt_totalsize(dtb)) {
+		return -FDT_ERR_NOSPACE;
+	}
+
+	/* Nothing is changed before this point */
+	strtab = dtb + fdt_off_dt_strings(dtb);
+	if (grow != 0) {
+		(void)memmove(strtab + grow, strtab, strings_size);
+	}
+
+	for (i = 0U; i < fix->num_props; i++) {
+		if (fix->prop[i].nameoff >= (uint32_t)strings_size) {
+			name = &fix->data[fix->prop[i].name];
+			(void)memcpy(strtab + grow + fix->prop[i].nameoff, name,
+				     strlen(name) + 1U);
+		}
+	}
+
+	/*
+	 * Go through the splices backwards, moving the part of the structure
+	 * block after each one to its final place, then filling the splice.
+	 */
+	dt_struct = dtb + fdt_off_dt_struct(dtb);
+	end = (int)fdt_size_dt_struct(dtb);
+	shift = grow;
+	for (i = num; i-- > 0U;) {
+		s = &fix->splice[i];
+		offs = s->pos + s->old_size;
+		if (shift != 0) {
+			(void)memmove(dt_struct + offs + shift, dt_struct + offs,
+				      end - offs);
+		}
+
+		shift -= fixup_emit_splice(fix, s, NULL) - s->old_size;
+		(void)fixup_emit_splice(fix, s, dt_struct + s->pos + shift);
+		end = s->pos;
+	}
+
+	assert(shift == 0);
+
+	fdt_set_size_dt_struct(dtb, fdt_size_dt_struct(dtb) + grow);
+	fdt_set_off_dt_strings(dtb, fdt_off_dt_strings(dtb) + grow);
+	fdt_set_size_dt_strings(dtb, strings_size + new_strings);
+
+	return 0;
+}
+
+/*
+ * Apply the edits recorded in 'fix', which can then be used for new ones.
+ * The DTB must have room for them, see fdt_open_into(). Node offsets and
+ * handles of added nodes are no longer valid afterwards. Returns 0 on success,
+ * or a negative libfdt error value, in which case the contents of the DTB are
+ * unchanged.
+ */
+int fdt_fixup_commit(struct fdt_fixup *fix)
+{
+	int ret = fix->err;
+
+	if (ret == 0) {
+		fdtw_index_invalidate(fix->dtb);
+		ret = fixup_apply(fix);
+	}
+
+	if (ret < 0) {
+		ERROR("FDT: fixup failed: %s\n", fdt_strerror(ret));
+	}
+
+	fdt_fixup_init(fix, fix->dtb);
+
+	return ret;
+}
+
+/*
+ * The one-shot helpers below, dt_add_psci_node() and others, keep using
+ * libfdt directly. Unlike a transaction, they have no limit on the number of
+ * edits and don't need a struct fdt_fixup.
+ */
 static int append_psci_compatible(void *fdt, int offs, const char *str)
 {
 	return fdt_appendprop(fdt, offs, "compatible", str, strlen(str) + 1);
@@ -48,8 +622,8 @@ static int append_psci_compatible(void *fdt, int offs, const char *str)
 #endif
 
 /*******************************************************************************
- * dt_add_psci_node() - Add a PSCI node into an existing device tree
- * @fdt:	pointer to the device tree blob in memory
+ * fdt_fixup_psci_node() - Add a PSCI node into an existing device tree
+ * @fix:	fixup transaction of the device tree blob in memory
  *
  * Add a device tree node describing PSCI into the root level of an existing
  * device tree blob in memory.
@@ -57,10 +631,36 @@ static int append_psci_compatible(void *fdt, int offs, const char *str)
  * function IDs for v0.1 compatibility.
  * An existing PSCI node will not be touched, the function will return success
  * in this case. This function will not touch the /cpus enable methods, use
- * dt_add_psci_cpu_enable_methods() for that.
+ * fdt_fixup_psci_cpu_enable_methods() for that.
+ * dt_add_psci_node() does the same on its own.
  *
  * Return: 0 on success, -1 otherwise.
  ******************************************************************************/
+int fdt_fixup_psci_node(struct fdt_fixup *fix)
+{
+	static const char compatible[] = "arm,psci-1.0\0arm,psci-0.2\0arm,psci";
+	int offs;
+
+	if (fdt_path_offset(fix->dtb, "/psci") >= 0) {
+		WARN("PSCI Device Tree node already exists!\n");
+		return 0;
+	}
+
+	offs = fdt_fixup_add_subnode(fix, 0, "psci");
+	if (offs < 0)
+		return -1;
+
+	(void)fdt_fixup_setprop(fix, offs, "compatible", compatible,
+				sizeof(compatible));
+	(void)fdt_fixup_setprop_string(fix, offs, "method", "smc");
+	(void)fdt_fixup_setprop_u32(fix, offs, "cpu_suspend",
+				    PSCI_CPU_SUSPEND_FNID);
+	(void)fdt_fixup_setprop_u32(fix, offs, "cpu_off", PSCI_CPU_OFF);
+	(void)fdt_fixup_setprop_u32(fix, offs, "cpu_on", PSCI_CPU_ON_FNID);
+
+	return (fix->err == 0) ? 0 : -1;
+}
+
 int dt_add_psci_node(void *fdt)
 {
 	int offs;
@@ -93,6 +693,56 @@ int dt_add_psci_node(void *fdt)
 	return 0;
 }
 
+/*******************************************************************************
+ * fdt_fixup_psci_cpu_enable_methods() - switch CPU nodes in DT to use PSCI
+ * @fix:	fixup transaction of the device tree blob in memory
+ *
+ * Iterate over all CPU device tree nodes (/cpus/cpu@x) in memory to change
+ * the enable-method to PSCI. This will add the enable-method properties, if
+ * required, or will change existing properties to read "psci".
+ * dt_add_psci_cpu_enable_methods() does the same on its own.
+ *
+ * Return: 0 on success, or a negative error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_psci_cpu_enable_methods(struct fdt_fixup *fix)
+{
+	const void *fdt = fix->dtb;
+	int offs, cpus;
+
+	cpus = fdt_path_offset(fdt, "/cpus");
+	if (cpus < 0)
+		return cpus;
+
+	/* Iterate over all subnodes to find those with device_type = "cpu". */
+	fdt_for_each_subnode(offs, fdt, cpus) {
+		const char *prop;
+		int len;
+		int ret;
+
+		prop = fdt_getprop(fdt, offs, "device_type", &len);
+		if (prop == NULL)
+			continue;
+		if ((strcmp(prop, "cpu") != 0) || (len != 4))
+			continue;
+
+		/* Ignore any nodes which already use "psci". */
+		prop = fdt_getprop(fdt, offs, "enable-method", &len);
+		if ((prop != NULL) &&
+		    (strcmp(prop, "psci") == 0) && (len == 5))
+			continue;
+
+		ret = fdt_fixup_setprop_string(fix, offs, "enable-method",
+					       "psci");
+		if (ret < 0)
+			return ret;
+	}
+
+	if (offs == -FDT_ERR_NOTFOUND)
+		return 0;
+
+	return offs;
+}
+
 /*
  * Find the first subnode that has a "device_type" property with the value
  * "cpu" and which's enable-method is not "psci" (yet).
@@ -144,17 +794,6 @@ static int dt_update_one_cpu_node(void *fdt, int offset)
 	return offs;
 }
 
-/*******************************************************************************
- * dt_add_psci_cpu_enable_methods() - switch CPU nodes in DT to use PSCI
- * @fdt:	pointer to the device tree blob in memory
- *
- * Iterate over all CPU device tree nodes (/cpus/cpu@x) in memory to change
- * the enable-method to PSCI. This will add the enable-method properties, if
- * required, or will change existing properties to read "psci".
- *
- * Return: 0 on success, or a negative error value otherwise.
- ******************************************************************************/
-
 int dt_add_psci_cpu_enable_methods(void *fdt)
 {
 	int offs, ret;
@@ -173,8 +812,8 @@ int dt_add_psci_cpu_enable_methods(void *fdt)
 #define HIGH_BITS(x) ((sizeof(x) > 4) ? ((x) >> 32) : (typeof(x))0)
 
 /*******************************************************************************
- * fdt_add_reserved_memory() - reserve (secure) memory regions in DT
- * @dtb:	pointer to the device tree blob in memory
+ * fdt_fixup_reserved_memory() - reserve (secure) memory regions in DT
+ * @fix:	fixup transaction of the device tree blob in memory
  * @node_name:	name of the subnode to be used
  * @base:	physical base address of the reserved region
  * @size:	size of the reserved region
@@ -190,9 +829,57 @@ int dt_add_psci_cpu_enable_methods(void *fdt)
  * documentation for details.
  * According to this binding, the address-cells and size-cells must match
  * those of the root node.
+ * fdt_add_reserved_memory() does the same on its own.
  *
  * Return: 0 on success, a negative error value otherwise.
  ******************************************************************************/
+int fdt_fixup_reserved_memory(struct fdt_fixup *fix, const char *node_name,
+			      uintptr_t base, size_t size)
+{
+	int offs = fdt_path_offset(fix->dtb, "/reserved-memory");
+	uint32_t addresses[4];
+	int ac, sc;
+	unsigned int idx = 0;
+
+	ac = fdt_address_cells(fix->dtb, 0);
+	sc = fdt_size_cells(fix->dtb, 0);
+	if (offs < 0) {			/* create if not existing yet */
+		offs = fdt_fixup_add_subnode(fix, 0, "reserved-memory");
+		if (offs < 0) {
+			return offs;
+		}
+		(void)fdt_fixup_setprop_u32(fix, offs, "#address-cells", ac);
+		(void)fdt_fixup_setprop_u32(fix, offs, "#size-cells", sc);
+		(void)fdt_fixup_setprop(fix, offs, "ranges", NULL, 0);
+	}
+
+	if (ac > 1) {
+		addresses[idx] = cpu_to_fdt32(HIGH_BITS(base));
+		idx++;
+	}
+	addresses[idx] = cpu_to_fdt32(base & 0xffffffff);
+	idx++;
+	if (sc > 1) {
+		addresses[idx] = cpu_to_fdt32(HIGH_BITS(size));
+		idx++;
+	}
+	addresses[idx] = cpu_to_fdt32(size & 0xffffffff);
+	idx++;
+
+	/* Leave an existing region alone */
+	if (!fixup_is_new(fix, offs) &&
+	    (fdt_subnode_offset(fix->dtb, offs, node_name) >= 0)) {
+		return fix->err;
+	}
+
+	offs = fdt_fixup_add_subnode(fix, offs, node_name);
+	(void)fdt_fixup_setprop(fix, offs, "no-map", NULL, 0);
+	(void)fdt_fixup_setprop(fix, offs, "reg", addresses,
+				idx * sizeof(uint32_t));
+
+	return fix->err;
+}
+
 int fdt_add_reserved_memory(void *dtb, const char *node_name,
 			    uintptr_t base, size_t size)
 {
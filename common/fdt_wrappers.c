@@ -188,6 +188,18 @@ int fdtw_read_uuid(const void *dtb, int node, const char *prop,
 	return 0;
 }
 
+/*
+ * Whether the index of fdtw_index_init() keeps the value of 'prop'. Writing such
+ * a property in place makes the index of the DTB stale.
+ */
+static bool fdtw_index_keeps_prop(const char *prop)
+{
+	return (strcmp(prop, "phandle") == 0) ||
+	       (strcmp(prop, "linux,phandle") == 0) ||
+	       (strcmp(prop, "#address-cells") == 0) ||
+	       (strcmp(prop, "#size-cells") == 0);
+}
+
 /*
  * Write cells in place to a given property of the given node. At most 2 cells
  * of the property are written. Returns 0 on success, and -1 upon error.
@@ -212,6 +224,10 @@ int fdtw_write_inplace_cells(void *dtb, int node, const char *prop,
 
 	len = (int)cells * 4;
 
+	if (fdtw_index_keeps_prop(prop)) {
+		fdtw_index_invalidate(dtb);
+	}
+
 	/* Set property value in place */
 	err = fdt_setprop_inplace(dtb, node, prop, value, len);
 	if (err != 0) {
@@ -253,6 +269,10 @@ int fdtw_write_inplace_bytes(void *dtb, int node, const char *prop,
 		return -1;
 	}
 
+	if (fdtw_index_keeps_prop(prop)) {
+		fdtw_index_invalidate(dtb);
+	}
+
 	/* Set property value in place */
 	err = fdt_setprop_inplace_namelen_partial(dtb, node, prop,
 						  namelen, 0,
@@ -283,13 +303,13 @@ int fdt_get_reg_props_by_index(const void *dtb, int node, int index,
 	int ac, sc;
 	int cell;
 
-	parent = fdt_parent_offset(dtb, node);
+	parent = fdtw_parent_offset(dtb, node);
 	if (parent < 0) {
 		return -FDT_ERR_BADOFFSET;
 	}
 
-	ac = fdt_address_cells(dtb, parent);
-	sc = fdt_size_cells(dtb, parent);
+	ac = fdtw_address_cells(dtb, parent);
+	sc = fdtw_size_cells(dtb, parent);
 
 	cell = index * (ac + sc);
 
@@ -344,9 +364,9 @@ int fdt_get_stdout_node_offset(const void *dtb)
 	int len;
 
 	/* The /secure-chosen node takes precedence over the standard one. */
-	node = fdt_path_offset(dtb, "/secure-chosen");
+	node = fdtw_path_offset(dtb, "/secure-chosen");
 	if (node < 0) {
-		node = fdt_path_offset(dtb, "/chosen");
+		node = fdtw_path_offset(dtb, "/chosen");
 		if (node < 0) {
 			return -FDT_ERR_NOTFOUND;
 		}
@@ -440,10 +460,10 @@ static uint64_t fdtw_search_all_xlat_entries(const void *dtb,
 	 *              = 1                 + 2                      + 1
 	 */
 
-	parent_bus_node = fdt_parent_offset(dtb, local_bus);
-	self_addr_cells = fdt_address_cells(dtb, local_bus);
-	self_size_cells = fdt_size_cells(dtb, local_bus);
-	parent_addr_cells = fdt_address_cells(dtb, parent_bus_node);
+	parent_bus_node = fdtw_parent_offset(dtb, local_bus);
+	self_addr_cells = fdtw_address_cells(dtb, local_bus);
+	self_size_cells = fdtw_size_cells(dtb, local_bus);
+	parent_addr_cells = fdtw_address_cells(dtb, parent_bus_node);
 
 	/* Number of cells per translation entry i.e., mapping */
 	ncells_xlat = self_addr_cells + parent_addr_cells + self_size_cells;
@@ -532,7 +552,7 @@ uint64_t fdtw_translate_address(const void *dtb, int node,
 	const char *node_name;
 	uint64_t global_address;
 
-	local_bus_node = fdt_parent_offset(dtb, node);
+	local_bus_node = fdtw_parent_offset(dtb, node);
 	node_name = fdt_get_name(dtb, local_bus_node, NULL);
 
 	/*
@@ -589,7 +609,7 @@ int fdtw_for_each_cpu(const void *dtb,
 	int ret = 0;
 	int parent, node = 0;
 
-	parent = fdt_path_offset(dtb, "/cpus");
+	parent = fdtw_path_offset(dtb, "/cpus");
 	if (parent < 0) {
 		return parent;
 	}
@@ -630,6 +650,7 @@ int fdtw_find_or_add_subnode(void *fdt, int parentoffset, const char *name)
 	offset = fdt_subnode_offset(fdt, parentoffset, name);
 
 	if (offset == -FDT_ERR_NOTFOUND) {
+		fdtw_index_invalidate(fdt);
 		offset = fdt_add_subnode(fdt, parentoffset, name);
 	}
 
@@ -639,3 +660,256 @@ int fdtw_find_or_add_subnode(void *fdt, int parentoffset, const char *name)
 
 	return offset;
 }
+
+/*
+ * The lookups below walk the whole tree, or the path from the root to a node.
+ * When a DTB is read many times, fdtw_index_init() records its nodes once, in
+ * offset order, with their parent, phandle and cell sizes, after which these
+ * come from the index. The nodes with a phandle are also sorted by it, and the
+ * offsets of the last looked up paths are kept too.
+ *
+ * The index describes a single DTB. Code which changes the structure of that
+ * DTB, or the properties the index keeps, must call fdtw_index_invalidate()
+ * first. The wrappers and fdt_fixup_commit() do, but direct libfdt calls,
+ * including the fdt_nop_*() ones, don't. As a safety net, the index is not
+ * used either once the size of the structure block of the DTB has changed.
+ */
+#define FDTW_INDEX_MAX_DEPTH	16
+#define FDTW_INDEX_PATHS	8U
+#define FDTW_INDEX_PATH_LEN	32U
+
+static struct {
+	const void *dtb;
+	uint32_t struct_size;
+	const struct fdtw_index_node *nodes;
+	unsigned int num_nodes;
+	unsigned int num_phandles;
+	struct {
+		char path[FDTW_INDEX_PATH_LEN];
+		int offset;
+	} paths[FDTW_INDEX_PATHS];
+	unsigned int next_path;
+} fdtw_index;
+
+void fdtw_index_clear(void)
+{
+	(void)memset(&fdtw_index, 0, sizeof(fdtw_index));
+}
+
+/* Drop the index if it describes 'dtb', which is about to be modified */
+void fdtw_index_invalidate(const void *dtb)
+{
+	if ((fdtw_index.nodes != NULL) && (dtb == fdtw_index.dtb)) {
+		VERBOSE("DT: index dropped\n");
+		fdtw_index_clear();
+	}
+}
+
+/*
+ * Index the nodes of 'dtb' in 'nodes', which can hold 'max_nodes' entries.
+ * The array must stay valid until fdtw_index_clear() or the next call.
+ * Returns the number of nodes on success, or a negative FDT error value, in
+ * which case no index is used.
+ */
+int fdtw_index_init(const void *dtb, struct fdtw_index_node *nodes,
+		    unsigned int max_nodes)
+{
+	int parents[FDTW_INDEX_MAX_DEPTH];
+	unsigned int n = 0U, num_phandles = 0U, i, j;
+	int node, depth = 0;
+
+	fdtw_index_clear();
+
+	/* Entries are numbered with 16 bits in by_phandle */
+	if (max_nodes > (UINT16_MAX + 1U)) {
+		max_nodes = UINT16_MAX + 1U;
+	}
+
+	for (node = 0; (node >= 0) && (depth >= 0);
+	     node = fdt_next_node(dtb, node, &depth)) {
+		if (depth >= FDTW_INDEX_MAX_DEPTH) {
+			return -FDT_ERR_BADSTRUCTURE;
+		}
+
+		if (n == max_nodes) {
+			return -FDT_ERR_NOSPACE;
+		}
+
+		parents[depth] = node;
+
+		nodes[n].offset = node;
+		nodes[n].parent = (depth > 0) ? parents[depth - 1] :
+				  -FDT_ERR_NOTFOUND;
+		nodes[n].phandle = fdt_get_phandle(dtb, node);
+		nodes[n].address_cells = (int8_t)fdt_address_cells(dtb, node);
+		nodes[n].size_cells = (int8_t)fdt_size_cells(dtb, node);
+		n++;
+	}
+
+	if ((node < 0) && (node != -FDT_ERR_NOTFOUND)) {
+		return node;
+	}
+
+	/*
+	 * Insertion sort of the nodes with a phandle, which mostly come in
+	 * phandle order already. Equal phandles keep their offset order, so
+	 * that lookups find the first one as libfdt does.
+	 */
+	for (i = 0U; i < n; i++) {
+		if (nodes[i].phandle == 0U) {
+			continue;
+		}
+
+		for (j = num_phandles; (j > 0U) &&
+		     (nodes[nodes[j - 1U].by_phandle].phandle >
+		      nodes[i].phandle); j--) {
+			nodes[j].by_phandle = nodes[j - 1U].by_phandle;
+		}
+
+		nodes[j].by_phandle = (uint16_t)i;
+		num_phandles++;
+	}
+
+	fdtw_index.dtb = dtb;
+	fdtw_index.struct_size = fdt_size_dt_struct(dtb);
+	fdtw_index.nodes = nodes;
+	fdtw_index.num_nodes = n;
+	fdtw_index.num_phandles = num_phandles;
+
+	VERBOSE("DT: indexed %u nodes, %u with a phandle\n", n, num_phandles);
+
+	return (int)n;
+}
+
+static bool fdtw_index_valid(const void *dtb)
+{
+	return (fdtw_index.nodes != NULL) && (dtb == fdtw_index.dtb) &&
+	       (fdt_size_dt_struct(dtb) == fdtw_index.struct_size);
+}
+
+/* Entry of 'node' in the index, NULL if there is none */
+static const struct fdtw_index_node *fdtw_index_find(const void *dtb, int node)
+{
+	unsigned int lo = 0U, hi, mid;
+
+	if (!fdtw_index_valid(dtb)) {
+		return NULL;
+	}
+
+	hi = fdtw_index.num_nodes;
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2U);
+		if (fdtw_index.nodes[mid].offset == node) {
+			return &fdtw_index.nodes[mid];
+		}
+
+		if (fdtw_index.nodes[mid].offset < node) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return NULL;
+}
+
+/* fdt_path_offset(), remembering the result for the last few paths */
+int fdtw_path_offset(const void *dtb, const char *path)
+{
+	unsigned int i;
+	int offset;
+
+	/* Unused entries have an empty path */
+	if (!fdtw_index_valid(dtb) || (path[0] == '\0')) {
+		return fdt_path_offset(dtb, path);
+	}
+
+	for (i = 0U; i < FDTW_INDEX_PATHS; i++) {
+		if (strcmp(fdtw_index.paths[i].path, path) == 0) {
+			return fdtw_index.paths[i].offset;
+		}
+	}
+
+	offset = fdt_path_offset(dtb, path);
+
+	/* Only remember whether a path exists, not other errors */
+	if (((offset >= 0) || (offset == -FDT_ERR_NOTFOUND)) &&
+	    (strlen(path) < FDTW_INDEX_PATH_LEN)) {
+		i = fdtw_index.next_path;
+		(void)strlcpy(fdtw_index.paths[i].path, path,
+			      FDTW_INDEX_PATH_LEN);
+		fdtw_index.paths[i].offset = offset;
+		fdtw_index.next_path = (i + 1U) % FDTW_INDEX_PATHS;
+	}
+
+	return offset;
+}
+
+/* fdt_parent_offset(), from the index if there is one */
+int fdtw_parent_offset(const void *dtb, int node)
+{
+	const struct fdtw_index_node *entry = fdtw_index_find(dtb, node);
+
+	if (entry == NULL) {
+		return fdt_parent_offset(dtb, node);
+	}
+
+	return entry->parent;
+}
+
+/* fdt_address_cells(), from the index if there is one */
+int fdtw_address_cells(const void *dtb, int node)
+{
+	const struct fdtw_index_node *entry = fdtw_index_find(dtb, node);
+
+	if (entry == NULL) {
+		return fdt_address_cells(dtb, node);
+	}
+
+	return entry->address_cells;
+}
+
+/* fdt_size_cells(), from the index if there is one */
+int fdtw_size_cells(const void *dtb, int node)
+{
+	const struct fdtw_index_node *entry = fdtw_index_find(dtb, node);
+
+	if (entry == NULL) {
+		return fdt_size_cells(dtb, node);
+	}
+
+	return entry->size_cells;
+}
+
+/* fdt_node_offset_by_phandle(), from the index if there is one */
+int fdtw_node_offset_by_phandle(const void *dtb, uint32_t phandle)
+{
+	const struct fdtw_index_node *nodes = fdtw_index.nodes;
+	unsigned int lo = 0U, hi, mid;
+
+	if (!fdtw_index_valid(dtb)) {
+		return fdt_node_offset_by_phandle(dtb, phandle);
+	}
+
+	if ((phandle == 0U) || (phandle == UINT32_MAX)) {
+		return -FDT_ERR_BADPHANDLE;
+	}
+
+	/* First node in phandle order whose phandle is not below 'phandle' */
+	hi = fdtw_index.num_phandles;
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2U);
+		if (nodes[nodes[mid].by_phandle].phandle < phandle) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if ((lo < fdtw_index.num_phandles) &&
+	    (nodes[nodes[lo].by_phandle].phandle == phandle)) {
+		return nodes[nodes[lo].by_phandle].offset;
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
@@ -6,29 +6,135 @@
 
 #include <stdarg.h>
 #include <assert.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <plat/common/platform.h>
+#include <platform_def.h>
 
 /* Set the default maximum log level to the `LOG_LEVEL` build flag */
 static unsigned int max_log_level = LOG_LEVEL;
 
+#if LOG_BINARY_LEVEL
+#define TF_LOG_BIN_MAGIC	U(0x474f4c42)	/* "BLOG" */
+#define TF_LOG_BIN_MAX_ARGS	6U
+
+CASSERT(IS_POWER_OF_TWO(LOG_BINARY_RECORDS), assert_log_binary_records_pow2);
+
 /*
- * The common log function which is invoked by TF-A code.
- * This function should not be directly invoked and is meant to be
- * only used by the log macros defined in debug.h. The function
- * expects the first character in the format string to be one of the
- * LOG_MARKER_* macros defined in debug.h.
+ * Binary trace, decoded by tools/log_decode/log_decode.py. A record holds the
+ * address of the format string, without its log marker, with the log level in
+ * bits [63:56], the counter value when it was logged and the arguments, widened
+ * to 64 bits. Each CPU has its own ring, in which 'count' records have been
+ * written so far.
  */
-void tf_log(const char *fmt, ...)
+#define TF_LOG_BIN_LEVEL_SHIFT	56
+struct tf_log_record {
+	uint64_t fmt;
+	uint64_t timestamp;
+	uint64_t args[TF_LOG_BIN_MAX_ARGS];
+};
+
+struct tf_log_ring {
+	uint32_t magic;
+	uint32_t records;
+	uint64_t count;
+	struct tf_log_record record[LOG_BINARY_RECORDS];
+};
+
+struct tf_log_ring tf_log_rings[PLATFORM_CORE_COUNT];
+
+/*
+ * Record a message without formatting it. The format string is only scanned
+ * for the type of the arguments, using the conversions supported by printf().
+ * Arguments past TF_LOG_BIN_MAX_ARGS are dropped.
+ */
+static void tf_log_bin(unsigned int log_level, const char *fmt, va_list args)
 {
-	unsigned int log_level;
-	va_list args;
-	const char *prefix_str;
+	struct tf_log_ring *ring = &tf_log_rings[plat_my_core_pos()];
+	struct tf_log_record *rec;
+	unsigned long long arg;
+	unsigned int l_count, n = 0U;
+
+	rec = &ring->record[ring->count & (LOG_BINARY_RECORDS - 1U)];
+	rec->fmt = (uintptr_t)fmt |
+		   ((uint64_t)log_level << TF_LOG_BIN_LEVEL_SHIFT);
+	rec->timestamp = read_cntpct_el0();
+
+	for (; *fmt != '\0'; fmt++) {
+		if (*fmt != '%') {
+			continue;
+		}
+
+		/* Skip the padding and count the length modifiers */
+		for (fmt++, l_count = 0U; ; fmt++) {
+			if (*fmt == 'l') {
+				l_count++;
+			} else if (*fmt == 'z') {
+				l_count = (sizeof(size_t) == 8U) ? 2U : l_count;
+			} else if ((*fmt < '0') || (*fmt > '9')) {
+				break;
+			}
+		}
+
+		switch (*fmt) {
+		case 'i':
+		case 'd':
+			if (l_count == 0U) {
+				arg = (unsigned long long)va_arg(args, int);
+			} else if (l_count == 1U) {
+				arg = (unsigned long long)va_arg(args, long);
+			} else {
+				arg = (unsigned long long)va_arg(args, long long);
+			}
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+			if (l_count == 0U) {
+				arg = va_arg(args, unsigned int);
+			} else if (l_count == 1U) {
+				arg = va_arg(args, unsigned long);
+			} else {
+				arg = va_arg(args, unsigned long long);
+			}
+			break;
+		case 'c':
+			arg = (unsigned int)va_arg(args, int);
+			break;
+		case 's':
+		case 'p':
+			arg = (uintptr_t)va_arg(args, void *);
+			break;
+		case '%':
+			continue;
+		default:
+			/* printf() stops at anything else as well */
+			goto out;
+		}
+
+		if (n < TF_LOG_BIN_MAX_ARGS) {
+			rec->args[n++] = arg;
+		}
+	}
 
-	/* We expect the LOG_MARKER_* macro as the first character */
-	log_level = fmt[0];
+out:
+	ring->magic = TF_LOG_BIN_MAGIC;
+	ring->records = LOG_BINARY_RECORDS;
+	ring->count++;
+}
+#endif /* LOG_BINARY_LEVEL */
+
+/*
+ * Log a message at 'log_level', for the code which gets its format string and
+ * arguments from a va_list, like the log callbacks of third party drivers.
+ * Unlike tf_log(), the format string starts without a LOG_MARKER_* character.
+ */
+void tf_vlog(unsigned int log_level, const char *fmt, va_list args)
+{
+	const char *prefix_str;
 
 	/* Verify that log_level is one of LOG_MARKER_* macro defined in debug.h */
 	assert((log_level > 0U) && (log_level <= LOG_LEVEL_VERBOSE));
@@ -37,6 +143,13 @@ void tf_log(const char *fmt, ...)
 	if (log_level > max_log_level)
 		return;
 
+#if LOG_BINARY_LEVEL
+	if (log_level >= LOG_BINARY_LEVEL) {
+		tf_log_bin(log_level, fmt, args);
+		return;
+	}
+#endif
+
 	prefix_str = plat_log_get_prefix(log_level);
 
 	while (*prefix_str != '\0') {
@@ -44,8 +157,23 @@ void tf_log(const char *fmt, ...)
 		prefix_str++;
 	}
 
+	(void)vprintf(fmt, args);
+}
+
+/*
+ * The common log function which is invoked by TF-A code.
+ * This function should not be directly invoked and is meant to be
+ * only used by the log macros defined in debug.h. The function
+ * expects the first character in the format string to be one of the
+ * LOG_MARKER_* macros defined in debug.h.
+ */
+void tf_log(const char *fmt, ...)
+{
+	va_list args;
+
+	/* We expect the LOG_MARKER_* macro as the first character */
 	va_start(args, fmt);
-	(void)vprintf(fmt + 1, args);
+	tf_vlog(fmt[0], fmt + 1, args);
 	va_end(args);
 }
 
@@ -20,6 +20,7 @@
 #include <lib/fconf/fconf_tbbr_getter.h>
 #include <plat/common/platform.h>
 
+#include <tools_share/tbb_hash_chunk.h>
 #include <tools_share/zero_oid.h>
 
 /* ASN.1 tags */
@@ -33,6 +34,9 @@
 	} while (0)
 
 #pragma weak plat_set_nv_ctr2
+#if TBB_HASH_CHUNK_SIZE
+#pragma weak plat_auth_hash_chunks
+#endif
 
 __attribute__((weak)) int mtk_ar_check_consis(uint32_t nv_ctr)
 {
@@ -73,6 +77,79 @@ static int auth_get_param(const auth_param_type_desc_t *param_type_desc,
 	return 1;
 }
 
+#if TBB_HASH_CHUNK_SIZE
+/*
+ * Images are hashed as a list: the digest in the certificate is the hash of
+ * a header (see tbb_hash_chunk.h) followed by the SHA-256 digests of every
+ * TBB_HASH_CHUNK_SIZE bytes of the image. The chunk digests are independent,
+ * so platforms may compute them in parallel.
+ */
+#ifndef PLAT_TBB_HASH_MAX_CHUNKS
+#define PLAT_TBB_HASH_MAX_CHUNKS	64U
+#endif
+
+static unsigned char chunk_list[TBB_HASH_CHUNK_HDR_SIZE +
+				(PLAT_TBB_HASH_MAX_CHUNKS *
+				 TBB_HASH_CHUNK_DIGEST_SIZE)];
+
+/*
+ * Default implementation: compute the SHA-256 digest of every 'chunk_size'
+ * bytes of 'data_ptr' on the calling CPU and store them back to back in
+ * 'digests'. The last chunk may be shorter.
+ */
+int plat_auth_hash_chunks(void *data_ptr, unsigned int data_len,
+			  unsigned int chunk_size, unsigned char *digests)
+{
+	unsigned char md[CRYPTO_MD_MAX_SIZE];
+	unsigned char *p = data_ptr;
+	unsigned int len;
+	int rc;
+
+	while (data_len != 0U) {
+		len = (data_len < chunk_size) ? data_len : chunk_size;
+
+		rc = crypto_mod_calc_hash(CRYPTO_MD_SHA256, p, len, md);
+		return_if_error(rc);
+
+		memcpy(digests, md, TBB_HASH_CHUNK_DIGEST_SIZE);
+		digests += TBB_HASH_CHUNK_DIGEST_SIZE;
+		p += len;
+		data_len -= len;
+	}
+
+	return 0;
+}
+
+static int auth_hash_chunked(void *data_ptr, unsigned int data_len,
+			     void *hash_der_ptr, unsigned int hash_der_len)
+{
+	unsigned int num_chunks;
+	int rc;
+
+	num_chunks = (data_len / TBB_HASH_CHUNK_SIZE) +
+		     (((data_len % TBB_HASH_CHUNK_SIZE) != 0U) ? 1U : 0U);
+	if (num_chunks > PLAT_TBB_HASH_MAX_CHUNKS) {
+		ERROR("Image too large for chunked hash (%u chunks)\n",
+		      num_chunks);
+		return 1;
+	}
+
+	tbb_hash_chunk_hdr(chunk_list, TBB_HASH_CHUNK_SIZE, data_len);
+
+	if (data_len != 0U) {
+		rc = plat_auth_hash_chunks(data_ptr, data_len,
+					   TBB_HASH_CHUNK_SIZE,
+					   chunk_list + TBB_HASH_CHUNK_HDR_SIZE);
+		return_if_error(rc);
+	}
+
+	return crypto_mod_verify_hash(chunk_list,
+				      TBB_HASH_CHUNK_HDR_SIZE +
+				      (num_chunks * TBB_HASH_CHUNK_DIGEST_SIZE),
+				      hash_der_ptr, hash_der_len);
+}
+#endif /* TBB_HASH_CHUNK_SIZE */
+
 /*
  * Authenticate an image by matching the data hash
  *
@@ -117,9 +194,17 @@ static int auth_hash(const auth_method_param_hash_t *param,
 			img, img_len, &data_ptr, &data_len);
 	return_if_error(rc);
 
+#if TBB_HASH_CHUNK_SIZE
+	/*
+	 * Always use the chunked form, even for images of a single chunk, so
+	 * that raw and chunked hashes can never be confused for one another.
+	 */
+	rc = auth_hash_chunked(data_ptr, data_len, hash_der_ptr, hash_der_len);
+#else
 	/* Ask the crypto module to verify this hash */
 	rc = crypto_mod_verify_hash(data_ptr, data_len,
 				    hash_der_ptr, hash_der_len);
+#endif
 
 	return rc;
 }
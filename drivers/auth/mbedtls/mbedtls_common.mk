@@ -75,6 +75,26 @@ $(eval $(call add_defines,\
 )))
 endif
 
+#
+# SHA-256/SHA-512 block functions using the ARMv8 Cryptographic Extension,
+# with a C fallback for CPUs without it
+#
+MBEDTLS_SHA2_CE		?=	0
+$(eval $(call assert_boolean,MBEDTLS_SHA2_CE))
+
+ifeq (${MBEDTLS_SHA2_CE},1)
+ifneq (${ARCH},aarch64)
+$(error MBEDTLS_SHA2_CE is only supported on AArch64)
+endif
+MBEDTLS_SOURCES		+=	drivers/auth/mbedtls/mbedtls_sha2_ce.c		\
+				drivers/auth/mbedtls/aarch64/mbedtls_sha2_ce.S
+$(eval $(call add_defines,\
+    $(sort \
+        MBEDTLS_SHA256_PROCESS_ALT \
+        MBEDTLS_SHA512_PROCESS_ALT \
+)))
+endif
+
 ifeq (${MBEDTLS_MAJOR}, 2)
 	LIBMBEDTLS_SRCS +=  $(addprefix ${MBEDTLS_DIR}/library/,	\
 						rsa_internal.c		\
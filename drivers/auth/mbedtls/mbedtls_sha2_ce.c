@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdint.h>
+
+#define MBEDTLS_ALLOW_PRIVATE_ACCESS
+
+/* mbed TLS headers */
+#include <mbedtls/sha256.h>
+#include <mbedtls/sha512.h>
+
+#include <arch.h>
+#include <arch_helpers.h>
+
+/*
+ * SHA-256/SHA-512 block functions for mbed TLS (MBEDTLS_SHA256_PROCESS_ALT and
+ * MBEDTLS_SHA512_PROCESS_ALT), using the ARMv8 Cryptographic Extension when
+ * ID_AA64ISAR0_EL1 reports it and a C implementation otherwise.
+ *
+ * The extension uses the FP/SIMD registers, so it is only used by BL1 and BL2,
+ * which have no lower EL FP/SIMD state to preserve. Any other image including
+ * mbed TLS always takes the C path. At EL3 the CPTR_EL3.TFP trap is lifted
+ * around each block on the calling core, which may be a secondary core
+ * hashing chunks in parallel.
+ */
+
+#ifndef MBEDTLS_PRIVATE
+/* mbed TLS 2.x has no private struct members */
+#define MBEDTLS_PRIVATE(member)	member
+#endif
+
+void sha256_ce_transform(uint32_t state[8], const uint8_t *data,
+			 size_t blocks);
+void sha512_ce_transform(uint64_t state[8], const uint8_t *data,
+			 size_t blocks);
+
+/* Round constants, shared with the CE routines */
+const uint32_t sha256_k[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+#define ROR32(x, n)	(((x) >> (n)) | ((x) << (32 - (n))))
+#define ROR64(x, n)	(((x) >> (n)) | ((x) << (64 - (n))))
+#define CH(x, y, z)	(((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x, y, z)	(((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+
+#if defined(IMAGE_BL1) || defined(IMAGE_BL2)
+static unsigned int sha2_ce_level(void)
+{
+	/* ID_AA64ISAR0_EL1.SHA2 + 1, or 0 until probed */
+	static volatile unsigned int level;
+
+	if (level == 0U) {
+		level = ((read_id_aa64isar0_el1() >> ID_AA64ISAR0_SHA2_SHIFT) &
+			 ID_AA64ISAR0_SHA2_MASK) + 1U;
+	}
+
+	return level - 1U;
+}
+#else
+static inline unsigned int sha2_ce_level(void)
+{
+	return 0U;
+}
+#endif
+
+static uint32_t load_be32(const unsigned char *p)
+{
+	return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) |
+	       ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static uint64_t load_be64(const unsigned char *p)
+{
+	return ((uint64_t)load_be32(p) << 32) | load_be32(p + 4);
+}
+
+#if defined(MBEDTLS_SHA256_C) && defined(MBEDTLS_SHA256_PROCESS_ALT)
+static void sha256_transform_c(uint32_t state[8], const unsigned char *data)
+{
+	uint32_t w[16], s[8], t1, t2, s0, s1;
+	unsigned int i;
+
+	for (i = 0U; i < 8U; i++) {
+		s[i] = state[i];
+	}
+
+	for (i = 0U; i < 64U; i++) {
+		if (i < 16U) {
+			w[i] = load_be32(data + 4U * i);
+		} else {
+			s0 = w[(i + 1U) & 15U];
+			s1 = w[(i + 14U) & 15U];
+			w[i & 15U] += (ROR32(s1, 17) ^ ROR32(s1, 19) ^ (s1 >> 10)) +
+				      w[(i + 9U) & 15U] +
+				      (ROR32(s0, 7) ^ ROR32(s0, 18) ^ (s0 >> 3));
+		}
+
+		t1 = s[7] + (ROR32(s[4], 6) ^ ROR32(s[4], 11) ^ ROR32(s[4], 25)) +
+		     CH(s[4], s[5], s[6]) + sha256_k[i] + w[i & 15U];
+		t2 = (ROR32(s[0], 2) ^ ROR32(s[0], 13) ^ ROR32(s[0], 22)) +
+		     MAJ(s[0], s[1], s[2]);
+
+		s[7] = s[6];
+		s[6] = s[5];
+		s[5] = s[4];
+		s[4] = s[3] + t1;
+		s[3] = s[2];
+		s[2] = s[1];
+		s[1] = s[0];
+		s[0] = t1 + t2;
+	}
+
+	for (i = 0U; i < 8U; i++) {
+		state[i] += s[i];
+	}
+}
+
+int mbedtls_internal_sha256_process(mbedtls_sha256_context *ctx,
+				    const unsigned char data[64])
+{
+	u_register_t cptr;
+
+	if (sha2_ce_level() >= ID_AA64ISAR0_SHA2_SHA256) {
+		cptr = fp_trap_el3_disable();
+		sha256_ce_transform(ctx->MBEDTLS_PRIVATE(state), data, 1U);
+		fp_trap_el3_restore(cptr);
+	} else {
+		sha256_transform_c(ctx->MBEDTLS_PRIVATE(state), data);
+	}
+
+	return 0;
+}
+#endif /* MBEDTLS_SHA256_C && MBEDTLS_SHA256_PROCESS_ALT */
+
+const uint64_t sha512_k[80] = {
+	0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f,
+	0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019,
+	0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242,
+	0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+	0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235,
+	0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3,
+	0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275,
+	0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+	0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f,
+	0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725,
+	0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc,
+	0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+	0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6,
+	0x92722c851482353b, 0xa2bfe8a14cf10364, 0xa81a664bbc423001,
+	0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218,
+	0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+	0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99,
+	0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb,
+	0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc,
+	0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+	0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915,
+	0xc67178f2e372532b, 0xca273eceea26619c, 0xd186b8c721c0c207,
+	0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba,
+	0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+	0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc,
+	0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a,
+	0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+#if defined(MBEDTLS_SHA512_C) && defined(MBEDTLS_SHA512_PROCESS_ALT)
+static void sha512_transform_c(uint64_t state[8], const unsigned char *data)
+{
+	uint64_t w[16], s[8], t1, t2, s0, s1;
+	unsigned int i;
+
+	for (i = 0U; i < 8U; i++) {
+		s[i] = state[i];
+	}
+
+	for (i = 0U; i < 80U; i++) {
+		if (i < 16U) {
+			w[i] = load_be64(data + 8U * i);
+		} else {
+			s0 = w[(i + 1U) & 15U];
+			s1 = w[(i + 14U) & 15U];
+			w[i & 15U] += (ROR64(s1, 19) ^ ROR64(s1, 61) ^ (s1 >> 6)) +
+				      w[(i + 9U) & 15U] +
+				      (ROR64(s0, 1) ^ ROR64(s0, 8) ^ (s0 >> 7));
+		}
+
+		t1 = s[7] + (ROR64(s[4], 14) ^ ROR64(s[4], 18) ^ ROR64(s[4], 41)) +
+		     CH(s[4], s[5], s[6]) + sha512_k[i] + w[i & 15U];
+		t2 = (ROR64(s[0], 28) ^ ROR64(s[0], 34) ^ ROR64(s[0], 39)) +
+		     MAJ(s[0], s[1], s[2]);
+
+		s[7] = s[6];
+		s[6] = s[5];
+		s[5] = s[4];
+		s[4] = s[3] + t1;
+		s[3] = s[2];
+		s[2] = s[1];
+		s[1] = s[0];
+		s[0] = t1 + t2;
+	}
+
+	for (i = 0U; i < 8U; i++) {
+		state[i] += s[i];
+	}
+}
+
+int mbedtls_internal_sha512_process(mbedtls_sha512_context *ctx,
+				    const unsigned char data[128])
+{
+	u_register_t cptr;
+
+	/* Cortex-A53/A72/A73 implement SHA-256 but not SHA-512 */
+	if (sha2_ce_level() >= ID_AA64ISAR0_SHA2_SHA512) {
+		cptr = fp_trap_el3_disable();
+		sha512_ce_transform(ctx->MBEDTLS_PRIVATE(state), data, 1U);
+		fp_trap_el3_restore(cptr);
+	} else {
+		sha512_transform_c(ctx->MBEDTLS_PRIVATE(state), data);
+	}
+
+	return 0;
+}
+#endif /* MBEDTLS_SHA512_C && MBEDTLS_SHA512_PROCESS_ALT */
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <arch_helpers.h>
+#include <drivers/ring_console.h>
+#include <lib/cassert.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+/*
+ * In BL31, the CPUs share the backend through a lock, and whichever CPU holds
+ * it also drains the rings of the others. Exclusive accesses may not work with
+ * the data cache off, so BL31 must only register the ring console once its MMU
+ * is enabled, and a CPU running with its data cache off around a power down or
+ * a warm boot writes to the backend directly instead, see ring_console_putc().
+ * BL2 may run with the MMU off, so there each CPU only drains its own ring,
+ * without the lock.
+ */
+#ifdef IMAGE_BL31
+#define RING_SHARED_DRAIN	1
+#else
+#define RING_SHARED_DRAIN	0
+#endif
+
+CASSERT(offsetof(struct console_ring_buf, magic) == CONSOLE_RING_BUF_MAGIC,
+	assert_console_ring_buf_magic_offset_mismatch);
+CASSERT(offsetof(struct console_ring_buf, size) == CONSOLE_RING_BUF_SIZE,
+	assert_console_ring_buf_size_offset_mismatch);
+CASSERT(offsetof(struct console_ring_buf, head) == CONSOLE_RING_BUF_HEAD,
+	assert_console_ring_buf_head_offset_mismatch);
+CASSERT(offsetof(struct console_ring_buf, tail) == CONSOLE_RING_BUF_TAIL,
+	assert_console_ring_buf_tail_offset_mismatch);
+CASSERT(offsetof(struct console_ring_buf, data) == CONSOLE_RING_BUF_DATA,
+	assert_console_ring_buf_data_offset_mismatch);
+
+struct ring_console {
+	struct console console;
+	console_t *backend;
+	int (*tx_ready)(console_t *backend);
+	size_t slice;			/* bytes of the region per CPU */
+	spinlock_t lock;		/* held to send to the backend */
+};
+
+static struct console_ring_buf *ring_of(struct ring_console *ring,
+					unsigned int cpu)
+{
+	return (struct console_ring_buf *)(ring->console.base +
+					   (cpu * ring->slice));
+}
+
+/* Whether the calling CPU can take the lock, see RING_SHARED_DRAIN */
+static bool ring_can_lock(void)
+{
+#if RING_SHARED_DRAIN
+	return (read_sctlr_el3() & SCTLR_C_BIT) != 0U;
+#else
+	return true;
+#endif
+}
+
+static bool ring_trylock(struct ring_console *ring)
+{
+#if RING_SHARED_DRAIN
+	return ring_can_lock() && spin_trylock(&ring->lock);
+#else
+	return true;
+#endif
+}
+
+static void ring_lock(struct ring_console *ring)
+{
+#if RING_SHARED_DRAIN
+	spin_lock(&ring->lock);
+#endif
+}
+
+static void ring_unlock(struct ring_console *ring)
+{
+#if RING_SHARED_DRAIN
+	spin_unlock(&ring->lock);
+#endif
+}
+
+static void ring_backend_putc(console_t *backend, int c)
+{
+	if ((c == '\n') &&
+	    ((backend->flags & CONSOLE_FLAG_TRANSLATE_CRLF) != 0U)) {
+		(void)backend->putc('\r', backend);
+	}
+
+	(void)backend->putc(c, backend);
+}
+
+/*
+ * Send 'force' characters of the ring to the backend, waiting for it if needed,
+ * then carry on for as long as it can take more without waiting.
+ *
+ * Only the holder of the lock drains a ring, so that 'tail' has one writer.
+ * Without RING_SHARED_DRAIN, only the owning CPU drains its ring, but for
+ * console_flush(), which is meant for the points where the other CPUs are
+ * quiescent: before handing over to the next stage, at panic and at system
+ * off. Crash reports, which bypass console_flush(), drain the rings with
+ * console_ring_crash_getc() instead.
+ */
+static void ring_drain(struct ring_console *ring, struct console_ring_buf *buf,
+		       unsigned int force)
+{
+	console_t *backend = ring->backend;
+	uint32_t head = buf->head;
+	uint32_t tail = buf->tail;
+
+	/* Read the characters after the index that published them */
+	dmbish();
+
+	while (tail != head) {
+		if (force != 0U) {
+			force--;
+		} else if ((ring->tx_ready == NULL) ||
+			   (ring->tx_ready(backend) == 0)) {
+			break;
+		}
+
+		ring_backend_putc(backend, buf->data[tail]);
+
+		if (++tail == buf->size) {
+			tail = 0U;
+		}
+
+		/* The slot can be reused once the character has been read */
+		dmbish();
+		buf->tail = tail;
+	}
+}
+
+/*
+ * Drain the ring of 'cpu', then with RING_SHARED_DRAIN, those of the other
+ * CPUs, so that the output of a CPU which stopped logging is not held back
+ * until the next console_flush().
+ */
+static void ring_drain_from(struct ring_console *ring, unsigned int cpu)
+{
+	ring_drain(ring, ring_of(ring, cpu), 0U);
+
+#if RING_SHARED_DRAIN
+	for (unsigned int i = 1U; i < PLATFORM_CORE_COUNT; i++) {
+		ring_drain(ring,
+			   ring_of(ring, (cpu + i) % PLATFORM_CORE_COUNT), 0U);
+	}
+#endif
+}
+
+static int ring_console_putc(int c, console_t *console)
+{
+	struct ring_console *ring = (struct ring_console *)console;
+	unsigned int cpu = plat_my_core_pos();
+	struct console_ring_buf *buf = ring_of(ring, cpu);
+	uint32_t head;
+	uint32_t next;
+
+	/*
+	 * Without the lock, the ring of this CPU may be drained by another one:
+	 * leave it alone. It was emptied before the data cache was turned off.
+	 */
+	if (!ring_can_lock()) {
+		ring_backend_putc(ring->backend, c);
+		return c;
+	}
+
+	head = buf->head;
+	next = head + 1U;
+
+	if (next == buf->size) {
+		next = 0U;
+	}
+
+	/* Wait for the backend rather than dropping output when full */
+	while (next == buf->tail) {
+		ring_lock(ring);
+		ring_drain(ring, buf, 1U);
+		ring_unlock(ring);
+	}
+
+	buf->data[head] = (char)c;
+
+	/* Publish the character after writing it */
+	dmbishst();
+	buf->head = next;
+
+	/* Leave it to the CPU already sending to the backend, if any */
+	if (ring_trylock(ring)) {
+		ring_drain_from(ring, cpu);
+		ring_unlock(ring);
+	}
+
+	return c;
+}
+
+#if ENABLE_CONSOLE_GETC
+static int ring_console_getc(console_t *console)
+{
+	struct ring_console *ring = (struct ring_console *)console;
+
+	if (ring->backend->getc == NULL) {
+		return ERROR_NO_VALID_CONSOLE;
+	}
+
+	/* Show what was logged before waiting for input */
+	console_ring_drain();
+
+	return ring->backend->getc(ring->backend);
+}
+#endif
+
+static void ring_console_flush(console_t *console)
+{
+	struct ring_console *ring = (struct ring_console *)console;
+	unsigned int cpu;
+	bool locked;
+
+	/*
+	 * At panic, the lock may be held by a CPU which will never release it,
+	 * possibly this one: carry on without it then.
+	 */
+	locked = ring_trylock(ring);
+
+	for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		ring_drain(ring, ring_of(ring, cpu), UINT32_MAX);
+	}
+
+	if (ring->backend->flush != NULL) {
+		ring->backend->flush(ring->backend);
+	}
+
+	if (locked) {
+		ring_unlock(ring);
+	}
+
+	/* Leave the rings in memory for the next stage */
+	flush_dcache_range(console->base, ring->slice * PLATFORM_CORE_COUNT);
+}
+
+/*
+ * Rings left for console_ring_crash_getc() to drain, [next, end). Both stay 0
+ * until the ring console is registered.
+ */
+uintptr_t console_ring_crash_next;
+uintptr_t console_ring_crash_end;
+
+static struct ring_console ring_console = {
+	.console = {
+		.putc = ring_console_putc,
+#if ENABLE_CONSOLE_GETC
+		.getc = ring_console_getc,
+#endif
+		.flush = ring_console_flush,
+	},
+};
+
+void console_ring_drain(void)
+{
+	struct ring_console *ring = &ring_console;
+
+	/*
+	 * Nothing to do until the ring console is registered, nor with the data
+	 * cache off, when this CPU does not use its ring.
+	 */
+	if ((ring->backend == NULL) || !ring_can_lock()) {
+		return;
+	}
+
+	ring_lock(ring);
+	ring_drain(ring, ring_of(ring, plat_my_core_pos()), UINT32_MAX);
+	ring_unlock(ring);
+}
+
+int console_ring_register(uintptr_t base, size_t size, console_t *backend,
+			  int (*tx_ready)(console_t *backend))
+{
+	struct console_ring_buf *buf;
+	uint32_t data_size;
+	unsigned int cpu;
+
+	assert(backend != NULL);
+	assert(size / PLATFORM_CORE_COUNT > sizeof(struct console_ring_buf));
+
+	/* The ring console takes the place of its backend */
+	(void)console_unregister(backend);
+
+	ring_console.backend = backend;
+	ring_console.tx_ready = tx_ready;
+	ring_console.slice = (size / PLATFORM_CORE_COUNT) &
+			     ~(sizeof(uint32_t) - 1U);
+	ring_console.console.base = base;
+	ring_console.console.flags = backend->flags & CONSOLE_FLAG_SCOPE_MASK;
+
+	data_size = ring_console.slice - sizeof(struct console_ring_buf);
+
+	for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		buf = ring_of(&ring_console, cpu);
+
+		/* Keep the output a previous stage did not drain yet */
+		if ((buf->magic == CONSOLE_RING_MAGIC) &&
+		    (buf->size == data_size) && (buf->head < data_size) &&
+		    (buf->tail < data_size)) {
+			continue;
+		}
+
+		buf->magic = CONSOLE_RING_MAGIC;
+		buf->size = data_size;
+		buf->head = 0U;
+		buf->tail = 0U;
+	}
+
+	console_ring_crash_next = base;
+	console_ring_crash_end = base + (ring_console.slice * PLATFORM_CORE_COUNT);
+
+	return console_register(&ring_console.console);
+}
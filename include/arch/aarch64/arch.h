@@ -256,6 +256,18 @@
 #define ID_AA64ISAR0_RNDR_SHIFT	U(60)
 #define ID_AA64ISAR0_RNDR_MASK	ULL(0xf)
 
+#define ID_AA64ISAR0_TLB_SHIFT		U(56)
+#define ID_AA64ISAR0_TLB_MASK		ULL(0xf)
+#define ID_AA64ISAR0_TLB_RANGE		ULL(2)
+
+#define ID_AA64ISAR0_SHA2_SHIFT		U(12)
+#define ID_AA64ISAR0_SHA2_MASK		ULL(0xf)
+#define ID_AA64ISAR0_SHA2_SHA256	ULL(1)
+#define ID_AA64ISAR0_SHA2_SHA512	ULL(2)
+
+#define ID_AA64ISAR0_CRC32_SHIFT	U(16)
+#define ID_AA64ISAR0_CRC32_MASK		ULL(0xf)
+
 /* ID_AA64ISAR1_EL1 definitions */
 #define ID_AA64ISAR1_EL1		S3_0_C0_C6_1
 
@@ -994,6 +1006,20 @@
 #define TLBI_ADDR_MASK		ULL(0x00000FFFFFFFFFFF)
 #define TLBI_ADDR(x)		(((x) >> TLBI_ADDR_SHIFT) & TLBI_ADDR_MASK)
 
+/* Operand of the TLBI range instructions (FEAT_TLBIRANGE), 4KB granule */
+#define TLBI_RANGE_TG_4K	(ULL(1) << 46)
+#define TLBI_RANGE_SCALE_SHIFT	U(44)
+#define TLBI_RANGE_NUM_SHIFT	U(39)
+#define TLBI_RANGE_NUM_MASK	U(0x1f)
+#define TLBI_RANGE_SCALE_MAX	U(3)
+#define TLBI_RANGE_OP(addr, num, scale)				\
+	(TLBI_RANGE_TG_4K |					\
+	 ((uint64_t)(scale) << TLBI_RANGE_SCALE_SHIFT) |	\
+	 ((uint64_t)(num) << TLBI_RANGE_NUM_SHIFT) | TLBI_ADDR(addr))
+/* Number of pages invalidated by a range operand */
+#define TLBI_RANGE_PAGES(num, scale)				\
+	((uint64_t)((num) + 1U) << ((5U * (scale)) + 1U))
+
 /*******************************************************************************
  * Definitions of register offsets and fields in the CNTCTLBase Frame of the
  * system level implementation of the Generic Timer.
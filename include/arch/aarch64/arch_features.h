@@ -51,6 +51,18 @@ static inline bool is_armv8_2_ttcnp_present(void)
 		ID_AA64MMFR2_EL1_CNP_MASK) != 0U;
 }
 
+static inline bool is_feat_crc32_present(void)
+{
+	return ((read_id_aa64isar0_el1() >> ID_AA64ISAR0_CRC32_SHIFT) &
+		ID_AA64ISAR0_CRC32_MASK) != 0U;
+}
+
+static inline bool is_feat_tlbirange_present(void)
+{
+	return ((read_id_aa64isar0_el1() >> ID_AA64ISAR0_TLB_SHIFT) &
+		ID_AA64ISAR0_TLB_MASK) >= ID_AA64ISAR0_TLB_RANGE;
+}
+
 static inline bool is_feat_pacqarma3_present(void)
 {
 	uint64_t mask_id_aa64isar2 =
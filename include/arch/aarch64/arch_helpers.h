@@ -158,6 +158,7 @@ DEFINE_SYSOP_TYPE_FUNC(tlbi, alle2is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1)
+DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1is)
 #elif ERRATA_A76_1286807
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle1)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle1is)
@@ -166,6 +167,7 @@ DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle2is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(vmalle1)
+DEFINE_TLBIOP_ERRATA_TYPE_FUNC(vmalle1is)
 #else
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle1)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle1is)
@@ -174,6 +176,7 @@ DEFINE_SYSOP_TYPE_FUNC(tlbi, alle2is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle3)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle3is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1)
+DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1is)
 #endif
 
 #if ERRATA_A57_813419
@@ -199,6 +202,21 @@ DEFINE_SYSOP_TYPE_PARAM_FUNC(tlbi, vae3is)
 DEFINE_SYSOP_TYPE_PARAM_FUNC(tlbi, vale3is)
 #endif
 
+/*
+ * TLBI range instructions (FEAT_TLBIRANGE), written as SYS instructions so
+ * that they assemble whatever architecture version the toolchain targets. None
+ * of the cores affected by the errata above implements them.
+ */
+#define DEFINE_TLBIRANGE_PARAM_FUNC(_type, _encoding)		\
+static inline void tlbi ## _type(uint64_t v)			\
+{								\
+	__asm__ ("sys " _encoding ", %0" : : "r" (v));		\
+}
+
+DEFINE_TLBIRANGE_PARAM_FUNC(rvaae1is, "#0, c8, c2, #3")
+DEFINE_TLBIRANGE_PARAM_FUNC(rvae2is, "#4, c8, c2, #1")
+DEFINE_TLBIRANGE_PARAM_FUNC(rvae3is, "#6, c8, c2, #1")
+
 /*******************************************************************************
  * Cache maintenance accessor prototypes
  ******************************************************************************/
@@ -648,6 +666,34 @@ DEFINE_RENAME_SYSREG_RW_FUNCS(gpccr_el3, GPCCR_EL3)
 #define IS_IN_EL2() IS_IN_EL(2)
 #define IS_IN_EL3() IS_IN_EL(3)
 
+/*
+ * Lift the CPTR_EL3.TFP trap so that EL3 code may use the FP/SIMD registers,
+ * returning the previous CPTR_EL3 value for fp_trap_el3_restore(). Nothing is
+ * done below EL3, where the image has already set up CPACR_EL1/CPTR_EL2.
+ */
+static inline u_register_t fp_trap_el3_disable(void)
+{
+	u_register_t cptr = 0U;
+
+	if (IS_IN_EL3()) {
+		cptr = read_cptr_el3();
+		if ((cptr & TFP_BIT) != 0U) {
+			write_cptr_el3(cptr & ~TFP_BIT);
+			isb();
+		}
+	}
+
+	return cptr;
+}
+
+static inline void fp_trap_el3_restore(u_register_t cptr)
+{
+	if (IS_IN_EL3() && ((cptr & TFP_BIT) != 0U)) {
+		write_cptr_el3(cptr);
+		isb();
+	}
+}
+
 static inline unsigned int get_current_el(void)
 {
 	return GET_EL(read_CurrentEl());
@@ -695,13 +741,14 @@ static inline void tlbipaallos(void)
 }
 
 /*
- * Invalidate TLBs of GPT entries by Physical address, last level.
- *
- * @pa: the starting address for the range
- *      of invalidation
- * @size: size of the range of invalidation
+ * TLBIRPALOS instruction
+ * (TLB Range Invalidate GPT Information by PA,
+ * Last level, Outer Shareable)
  */
-void gpt_tlbi_by_pa_ll(uint64_t pa, size_t size);
+static inline void tlbirpalos(uint64_t xt)
+{
+	__asm__("SYS #6,c8,c4,#7,%0" : : "r" (xt));
+}
 
 
 /* Previously defined accessor functions with incomplete register names  */
@@ -128,6 +128,7 @@ void __dead2 elx_panic(void);
 void __dead2 __stack_chk_fail(void);
 
 void tf_log(const char *fmt, ...) __printflike(1, 2);
+void tf_vlog(unsigned int log_level, const char *fmt, va_list args);
 void tf_log_newline(const char log_fmt[2]);
 void tf_log_set_max_level(unsigned int log_level);
 
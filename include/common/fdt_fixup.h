@@ -23,6 +23,71 @@ struct psci_cpu_idle_state {
 	uint32_t wakeup_latency_us;
 };
 
+#ifndef FDT_FIXUP_MAX_NODES
+#define FDT_FIXUP_MAX_NODES	16U
+#endif
+#ifndef FDT_FIXUP_MAX_PROPS
+#define FDT_FIXUP_MAX_PROPS	48U
+#endif
+#ifndef FDT_FIXUP_DATA_SIZE
+#define FDT_FIXUP_DATA_SIZE	1024U
+#endif
+
+/*
+ * Edits collected by the fdt_fixup_*() functions, applied to the DTB at once
+ * by fdt_fixup_commit(). Names and values are copied to data[]. Beyond the
+ * limits above, the commit fails with -FDT_ERR_NOSPACE and leaves the DTB
+ * unchanged.
+ */
+struct fdt_fixup_node {
+	int parent;
+	uint16_t name;
+};
+
+struct fdt_fixup_prop {
+	int node;
+	uint16_t name;
+	uint16_t val;
+	uint16_t len;
+	uint32_t nameoff;
+	bool exists;		/* replaces a property of the DTB */
+};
+
+struct fdt_fixup_splice {
+	int pos;
+	int old_size;
+	int node;		/* node to add to, or property to replace */
+	unsigned int type;
+};
+
+struct fdt_fixup {
+	void *dtb;
+	int err;		/* first error, returned by fdt_fixup_commit() */
+	int new_node_base;	/* handle of the first added node */
+	unsigned int num_nodes;
+	unsigned int num_props;
+	unsigned int data_used;
+	struct fdt_fixup_node node[FDT_FIXUP_MAX_NODES];
+	struct fdt_fixup_prop prop[FDT_FIXUP_MAX_PROPS];
+	struct fdt_fixup_splice splice[FDT_FIXUP_MAX_PROPS + FDT_FIXUP_MAX_NODES];
+	char data[FDT_FIXUP_DATA_SIZE];
+};
+
+void fdt_fixup_init(struct fdt_fixup *fix, void *dtb);
+int fdt_fixup_add_subnode(struct fdt_fixup *fix, int parent, const char *name);
+int fdt_fixup_setprop(struct fdt_fixup *fix, int node, const char *name,
+		      const void *val, unsigned int len);
+int fdt_fixup_setprop_u32(struct fdt_fixup *fix, int node, const char *name,
+			  uint32_t val);
+int fdt_fixup_setprop_string(struct fdt_fixup *fix, int node,
+			     const char *name, const char *str);
+int fdt_fixup_commit(struct fdt_fixup *fix);
+
+int fdt_fixup_psci_node(struct fdt_fixup *fix);
+int fdt_fixup_psci_cpu_enable_methods(struct fdt_fixup *fix);
+int fdt_fixup_reserved_memory(struct fdt_fixup *fix, const char *node_name,
+			      uintptr_t base, size_t size);
+
 int dt_add_psci_node(void *fdt);
 int dt_add_psci_cpu_enable_methods(void *fdt);
 int fdt_add_reserved_memory(void *dtb, const char *node_name,
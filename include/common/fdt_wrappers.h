@@ -47,6 +47,27 @@ int fdtw_for_each_cpu(const void *fdt,
 
 int fdtw_find_or_add_subnode(void *fdt, int parentoffset, const char *name);
 
+/* Node of a DTB index, see fdtw_index_init() */
+struct fdtw_index_node {
+	int offset;
+	int parent;		/* negative for the root node */
+	uint32_t phandle;	/* 0 if none */
+	int8_t address_cells;
+	int8_t size_cells;
+	uint16_t by_phandle;	/* entry with the n-th phandle, if any */
+};
+
+int fdtw_index_init(const void *dtb, struct fdtw_index_node *nodes,
+		    unsigned int max_nodes);
+void fdtw_index_clear(void);
+void fdtw_index_invalidate(const void *dtb);
+
+int fdtw_path_offset(const void *dtb, const char *path);
+int fdtw_parent_offset(const void *dtb, int node);
+int fdtw_address_cells(const void *dtb, int node);
+int fdtw_size_cells(const void *dtb, int node);
+int fdtw_node_offset_by_phandle(const void *dtb, uint32_t phandle);
+
 static inline uint32_t fdt_blob_size(const void *dtb)
 {
 	const uint32_t *dtb_header = (const uint32_t *)dtb;
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef RING_CONSOLE_H
+#define RING_CONSOLE_H
+
+#include <drivers/console.h>
+
+#define CONSOLE_RING_MAGIC		U(0x474e4952)	/* "RING" */
+
+/* Offsets in struct console_ring_buf */
+#define CONSOLE_RING_BUF_MAGIC		U(0x0)
+#define CONSOLE_RING_BUF_SIZE		U(0x4)
+#define CONSOLE_RING_BUF_HEAD		U(0x8)
+#define CONSOLE_RING_BUF_TAIL		U(0xc)
+#define CONSOLE_RING_BUF_DATA		U(0x10)
+
+#ifndef __ASSEMBLER__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Header of the ring of one CPU. The memory given to console_ring_register()
+ * is split evenly between the CPUs, each slice starting with this header.
+ * Only the owning CPU writes 'head', so no lock is needed to log. 'tail' is
+ * written by the CPU sending the ring to the backend.
+ */
+struct console_ring_buf {
+	uint32_t magic;
+	uint32_t size;			/* of data[] */
+	volatile uint32_t head;		/* next character written */
+	volatile uint32_t tail;		/* next character drained */
+	char data[];
+};
+
+/*
+ * Buffer the output of the 'backend' console in per-CPU rings at
+ * [base, base + size), and register the ring console in its place.
+ *
+ * Characters are sent to the backend when 'tx_ready' reports that it can take
+ * one without waiting, when a ring is full, on console_ring_drain() and on
+ * console_flush(). With a NULL 'tx_ready', the output is only sent at these
+ * last three points. In BL31, a CPU logging also sends what the other CPUs
+ * left in their rings, under a spinlock: BL31 must only register the ring
+ * console once its MMU and data cache are enabled.
+ *
+ * Rings left in the region by a previous boot stage using the same layout are
+ * kept, so that their pending output is not lost. Returns 1 on success.
+ */
+int console_ring_register(uintptr_t base, size_t size, console_t *backend,
+			  int (*tx_ready)(console_t *backend));
+
+/*
+ * Send what is left in the ring of the calling CPU to the backend, waiting for
+ * it. For the points where the CPU stops logging for a while, such as before it
+ * is powered down, so that its last output is not held back.
+ */
+void console_ring_drain(void);
+
+/*
+ * Return the next character left in the rings, or -1 once they are all empty.
+ * For the crash console, which has no C runtime: plat_crash_console_init()
+ * can print what was buffered before the crash with it. Only clobbers x0 - x3.
+ */
+int console_ring_crash_getc(void);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* RING_CONSOLE_H */
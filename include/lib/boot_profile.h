@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Boot profile transfer list entry (TL_TAG_BOOT_PROFILE)
+ *
+ * Summary of the boot time table for the next stage, laid out as:
+ *
+ *   struct boot_profile
+ *   uint64_t stages[num_stages]		raw timestamps, in counter ticks
+ *   struct boot_profile_io io[num_io]		indexed by BOOT_PROFILE_IO_*
+ *   struct boot_profile_image images[num_images]
+ *
+ * All fields are little-endian. A timestamp or duration of 0 means it was not
+ * recorded. tools/boot_profile/boot_profile.py decodes the entry.
+ */
+#define BOOT_PROFILE_VERSION		U(1)
+
+/* Storage backends */
+#define BOOT_PROFILE_IO_MMC		U(0)
+#define BOOT_PROFILE_IO_NAND		U(1)
+#define BOOT_PROFILE_IO_NOR		U(2)
+#define BOOT_PROFILE_IO_OTHER		U(3)
+#define BOOT_PROFILE_IO_MAX		U(4)
+
+#ifndef __ASSEMBLER__
+#include <stdint.h>
+
+struct boot_profile {
+	uint32_t version;
+	uint32_t size;		/* of the whole entry */
+	uint64_t cntfrq;	/* frequency of the timestamps */
+	uint32_t num_stages;
+	uint32_t num_io;
+	uint32_t num_images;
+	uint32_t reserved;
+};
+
+struct boot_profile_io {
+	uint64_t bytes;		/* read from the backend */
+	uint32_t retries;	/* reads repeated by the driver */
+	uint32_t ecc_corrected;	/* bitflips corrected */
+	uint32_t ecc_failed;	/* uncorrectable pages */
+	uint32_t reserved;
+};
+
+struct boot_profile_image {
+	uint32_t image_id;
+	uint32_t reserved;
+	uint64_t bytes;		/* loaded from storage */
+	uint64_t load_ticks;
+	uint64_t auth_ticks;
+	uint64_t decomp_ticks;
+};
+#endif /* __ASSEMBLER__ */
+
+#endif /* BOOT_PROFILE_H */
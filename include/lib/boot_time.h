@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_TIME_H
+#define BOOT_TIME_H
+
+#include <lib/utils_def.h>
+
+/*
+ * Boot time PMF service
+ *
+ * Records when each boot phase starts and ends, and when each image is loaded
+ * and authenticated, along with I/O statistics of the storage backends. BL2
+ * hands its table over to BL31, which exposes it through the PMF SMC
+ * interface using the MPIDR of the boot CPU and can summarise it in a
+ * struct boot_profile for the next stage.
+ */
+
+/* Boot phases */
+#define BOOT_TIME_BL2_ENTRY		U(0)
+#define BOOT_TIME_STORAGE_INIT_START	U(1)
+#define BOOT_TIME_STORAGE_INIT_END	U(2)
+#define BOOT_TIME_GPT_PARSE_START	U(3)
+#define BOOT_TIME_GPT_PARSE_END		U(4)
+#define BOOT_TIME_BL2_EXIT		U(5)
+#define BOOT_TIME_BL31_ENTRY		U(6)
+#define BOOT_TIME_BL31_EXIT		U(7)
+#define BOOT_TIME_PHASE_IDS		U(16)
+
+/*
+ * Per-image events, one group per image ID below BOOT_TIME_MAX_IMAGES.
+ * BOOT_TIME_IMG_BYTES holds the number of bytes loaded, not a timestamp.
+ */
+#define BOOT_TIME_IMG_LOAD_START	U(0)
+#define BOOT_TIME_IMG_LOAD_END		U(1)
+#define BOOT_TIME_IMG_AUTH_START	U(2)
+#define BOOT_TIME_IMG_AUTH_END		U(3)
+#define BOOT_TIME_IMG_BYTES		U(4)
+#define BOOT_TIME_IMG_DECOMP_START	U(5)
+#define BOOT_TIME_IMG_DECOMP_END	U(6)
+#define BOOT_TIME_IMG_IDS		U(7)
+#define BOOT_TIME_MAX_IMAGES		U(40)
+
+#define BOOT_TIME_IMG_TID(_id, _ev)	\
+	(BOOT_TIME_PHASE_IDS + ((_id) * BOOT_TIME_IMG_IDS) + (_ev))
+
+#define BOOT_TIME_TOTAL_IDS		\
+	(BOOT_TIME_PHASE_IDS + (BOOT_TIME_MAX_IMAGES * BOOT_TIME_IMG_IDS))
+
+#ifndef __ASSEMBLER__
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/boot_profile.h>
+#include <lib/pmf/pmf.h>
+
+/* Passed from BL2 to BL31 */
+struct boot_time_handoff {
+	unsigned long long ts[BOOT_TIME_TOTAL_IDS];
+	struct boot_profile_io io[BOOT_PROFILE_IO_MAX];
+};
+
+#if BOOT_TIME_INSTRUMENTATION && (defined(IMAGE_BL2) || defined(IMAGE_BL31))
+PMF_DECLARE_CAPTURE_TIMESTAMP(boot_time_svc)
+PMF_DECLARE_GET_TIMESTAMP(boot_time_svc)
+
+/*
+ * Timestamps are cleaned to memory as they are taken, so that the table
+ * survives the hand over from BL2 to BL31 with the MMU off.
+ */
+#define BOOT_TIME_CAPTURE(_tid)						\
+	PMF_CAPTURE_TIMESTAMP(boot_time_svc, (_tid), PMF_CACHE_MAINT)
+
+void boot_time_capture_img(unsigned int image_id, unsigned int event);
+void boot_time_set_img_bytes(unsigned int image_id, unsigned long long bytes);
+void boot_time_account_io(unsigned int backend, size_t bytes);
+void boot_time_account_io_errors(unsigned int backend, unsigned int retries,
+				 unsigned int ecc_corrected,
+				 unsigned int ecc_failed);
+
+extern struct boot_time_handoff boot_time_handoff;
+
+void boot_time_export(void);
+void boot_time_import(uintptr_t handoff, size_t size);
+
+size_t boot_time_profile_size(void);
+void boot_time_fill_profile(struct boot_profile *bp);
+#else
+#define BOOT_TIME_CAPTURE(_tid)
+
+static inline void boot_time_capture_img(unsigned int image_id,
+					 unsigned int event)
+{
+}
+
+static inline void boot_time_set_img_bytes(unsigned int image_id,
+					   unsigned long long bytes)
+{
+}
+
+static inline void boot_time_account_io(unsigned int backend, size_t bytes)
+{
+}
+
+static inline void boot_time_account_io_errors(unsigned int backend,
+					       unsigned int retries,
+					       unsigned int ecc_corrected,
+					       unsigned int ecc_failed)
+{
+}
+
+static inline void boot_time_export(void)
+{
+}
+
+static inline void boot_time_import(uintptr_t handoff, size_t size)
+{
+}
+
+static inline size_t boot_time_profile_size(void)
+{
+	return 0U;
+}
+
+static inline void boot_time_fill_profile(struct boot_profile *bp)
+{
+}
+#endif /* BOOT_TIME_INSTRUMENTATION */
+
+#endif /* __ASSEMBLER__ */
+#endif /* BOOT_TIME_H */
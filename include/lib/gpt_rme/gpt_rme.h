@@ -42,6 +42,13 @@ typedef struct pas_region {
 
 #define GPT_NSE_SHIFT                   U(62)
 
+/*
+ * Largest range transitioned by one call to gpt_delegate_pas() or
+ * gpt_undelegate_pas(), which bounds the time the GPT lock is held for the
+ * cache maintenance of the range. Larger ranges are split by the caller.
+ */
+#define GPT_TRANSITION_MAX_SIZE		(UL(1) << 21)
+
 /* PAS attribute GPI definitions. */
 #define GPT_PAS_ATTR_GPI_SHIFT		U(0)
 #define GPT_PAS_ATTR_GPI_MASK		U(0xF)
@@ -261,14 +268,14 @@ void gpt_disable(void);
 /*
  * This function is the core of the granule transition service. When a granule
  * transition request occurs it is routed to this function where the request is
- * validated then fulfilled if possible.
- *
- * TODO: implement support for transitioning multiple granules at once.
+ * validated then fulfilled if possible. A range of granules is transitioned
+ * only if all of them are in the expected state.
  *
  * Parameters
  *   base: Base address of the region to transition, must be aligned to granule
  *         size.
- *   size: Size of region to transition, must be aligned to granule size.
+ *   size: Size of region to transition, must be aligned to granule size and
+ *         at most GPT_TRANSITION_MAX_SIZE.
  *   src_sec_state: Security state of the originating SMC invoking the API.
  *
  * Return
@@ -15,7 +15,9 @@
 #define RT_INSTR_EXIT_HW_LOW_PWR	U(3)
 #define RT_INSTR_ENTER_CFLUSH		U(4)
 #define RT_INSTR_EXIT_CFLUSH		U(5)
-#define RT_INSTR_TOTAL_IDS		U(6)
+#define RT_INSTR_ENTER_WORLD_SWITCH	U(6)
+#define RT_INSTR_EXIT_WORLD_SWITCH	U(7)
+#define RT_INSTR_TOTAL_IDS		U(8)
 
 #ifndef __ASSEMBLER__
 PMF_DECLARE_CAPTURE_TIMESTAMP(rt_instr_svc)
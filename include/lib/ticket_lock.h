@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TICKET_LOCK_H
+#define TICKET_LOCK_H
+
+#ifndef __ASSEMBLER__
+#include <cdefs.h>
+#include <stdint.h>
+
+#include <platform_def.h>
+
+/*
+ * Ticket lock in cacheable Normal memory
+ *
+ * Contenders take a ticket from 'next' and wait until 'owner' reaches it.
+ * Unlike bakery locks, acquiring the lock costs a single atomic increment and
+ * does not scan per-CPU state, so its cost does not grow with the core count.
+ *
+ * The lock may only be acquired with the data cache enabled, but it may be
+ * released with the data cache disabled, e.g. after the power down cache
+ * maintenance in PSCI. To allow that, 'owner' lives in a cache line of its
+ * own that is only written by the lock holder and cleaned to the point of
+ * coherency after each cached write, in the same way as bakery_lock_normal.c
+ * handles its per-CPU data.
+ */
+typedef struct ticket_lock {
+	volatile uint32_t next __aligned(CACHE_WRITEBACK_GRANULE);
+	volatile uint32_t owner __aligned(CACHE_WRITEBACK_GRANULE);
+} ticket_lock_t;
+
+void ticket_lock_get(ticket_lock_t *lock);
+void ticket_lock_release(ticket_lock_t *lock);
+
+/* Take a ticket, returns the previous value of *next */
+uint32_t ticket_lock_take(volatile uint32_t *next);
+
+#define DEFINE_TICKET_LOCK(_name)	ticket_lock_t _name
+#define DECLARE_TICKET_LOCK(_name)	extern ticket_lock_t _name
+
+#endif /* __ASSEMBLER__ */
+#endif /* TICKET_LOCK_H */
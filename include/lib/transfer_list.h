@@ -34,8 +34,19 @@ enum transfer_list_tag_id {
 	TL_TAG_HOB_BLOCK = 2,
 	TL_TAG_HOB_LIST = 3,
 	TL_TAG_ACPI_TABLE_AGGREGATE = 4,
+	/*
+	 * Non-standard tags, in the 0xff_f000 - 0xff_ffff range the handoff
+	 * specification sets aside for them
+	 */
+	/* see include/lib/boot_profile.h */
+	TL_TAG_BOOT_PROFILE = 0xfff000,
+	/* see struct transfer_list_index */
+	TL_TAG_TL_INDEX = 0xfff001,
 };
 
+// tag ids are 3 bytes wide
+#define TL_TAG_ID_MASK		U(0xffffff)
+
 enum transfer_list_ops {
 	TL_OPS_NON,	// invalid for any operation
 	TL_OPS_ALL,	// valid for all operations
@@ -64,8 +75,8 @@ struct transfer_list_header {
 };
 
 struct transfer_list_entry {
-	uint16_t	tag_id;
-	uint8_t		reserved0;	// place holder
+	uint16_t	tag_id;		// bits [15:0] of the tag id
+	uint8_t		tag_id_hi;	// bits [23:16] of the tag id
 	uint8_t		hdr_size;
 	uint32_t	data_size;
 	/*
@@ -79,6 +90,27 @@ struct transfer_list_entry {
 	 */
 };
 
+/*
+ * Optional index of the entries of a transfer list, sorted by tag and then by
+ * position, so that transfer_list_find() doesn't have to walk the list. It is
+ * the data of the first TE of the list, tagged TL_TAG_TL_INDEX, and is only
+ * used while 'tl_size' matches the size of the list: entries added by code
+ * which doesn't maintain the index make lookups fall back to a walk. So do
+ * lookups of tags missing from the index. transfer_list_update_checksum(),
+ * which code editing entries in place must call, rebuilds the index.
+ */
+struct transfer_list_index_entry {
+	uint32_t	tag_id;
+	uint32_t	offset;		// of the TE from the TL header
+};
+
+struct transfer_list_index {
+	uint32_t	tl_size;
+	uint16_t	count;
+	uint16_t	max_count;
+	struct transfer_list_index_entry entries[];
+};
+
 void transfer_list_dump(struct transfer_list_header *tl);
 struct transfer_list_header *transfer_list_init(void *addr, size_t max_size);
 
@@ -97,18 +129,21 @@ void *transfer_list_entry_data(struct transfer_list_entry *entry);
 bool transfer_list_rem(struct transfer_list_header *tl, struct transfer_list_entry *entry);
 
 struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
-					      uint16_t tag_id, uint32_t data_size,
+					      uint32_t tag_id, uint32_t data_size,
 					      const void *data);
 
 struct transfer_list_entry *transfer_list_add_with_align(struct transfer_list_header *tl,
-							 uint16_t tag_id, uint32_t data_size,
+							 uint32_t tag_id, uint32_t data_size,
 							 const void *data, uint8_t alignment);
 
 struct transfer_list_entry *transfer_list_next(struct transfer_list_header *tl,
 					       struct transfer_list_entry *last);
 
 struct transfer_list_entry *transfer_list_find(struct transfer_list_header *tl,
-					       uint16_t tag_id);
+					       uint32_t tag_id);
+
+bool transfer_list_add_index(struct transfer_list_header *tl,
+			     uint16_t max_count);
 
 #endif /*__ASSEMBLER__*/
 #endif /*__TRANSFER_LIST_H*/
@@ -76,6 +76,9 @@
 #define MT_SHAREABILITY_MASK	(U(3) << MT_SHAREABILITY_SHIFT)
 #define MT_SHAREABILITY(_attr)	((_attr) & MT_SHAREABILITY_MASK)
 
+/* Contiguous mapping of a static region (XLAT_TABLES_CONTIG) */
+#define MT_CONTIG_SHIFT		U(10)
+
 /* All other bits are reserved */
 
 /*
@@ -130,6 +133,13 @@
 #define MT_SHAREABILITY_OSH	(U(2) << MT_SHAREABILITY_SHIFT)
 #define MT_SHAREABILITY_NSH	(U(3) << MT_SHAREABILITY_SHIFT)
 
+/*
+ * With XLAT_TABLES_CONTIG=1, a static region with this attribute can be merged
+ * with adjacent ones with the same attributes and be mapped with the contiguous
+ * hint. Its attributes cannot be changed afterwards. It is ignored otherwise.
+ */
+#define MT_CONTIG		(U(1) << MT_CONTIG_SHIFT)
+
 /* Compound attributes for most common usages */
 #define MT_CODE			(MT_MEMORY | MT_RO | MT_EXECUTE)
 #define MT_RO_DATA		(MT_MEMORY | MT_RO | MT_EXECUTE_NEVER)
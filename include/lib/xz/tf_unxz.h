@@ -12,6 +12,8 @@
 
 void xz_simple_puts(const char *s);
 
+void unxz_init(void);
+
 int unxz(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf, size_t out_len,
 	 uintptr_t work_buf, size_t work_len);
 
@@ -128,6 +128,26 @@
 					/* 0x1B3 */
 #define RMM_ATTEST_GET_PLAT_TOKEN	SMC64_RMMD_EL3_FID(U(3))
 
+/*
+ * Delegate/undelegate a range of contiguous granules. A call transitions at
+ * most the first GPT_TRANSITION_MAX_SIZE (2MB) bytes of the range, in full or
+ * not at all, and returns the size it transitioned: the RMM calls again for the
+ * rest. These are not part of the RMM-EL3 interface version, so they are
+ * allocated down from the end of the range, away from the FIDs the
+ * specification assigns in order. An RMM finds out whether they are
+ * implemented from an SMC_UNK return.
+ * The arguments to this SMC are :
+ *    arg0 - Function ID.
+ *    arg1 - Physical address of the first granule.
+ *    arg2 - Size of the range (in bytes), a multiple of the granule size.
+ * The return arguments are :
+ *    ret0 - Status / error.
+ *    ret1 - Size (in bytes) transitioned from arg1 if successful, 0 otherwise.
+ */
+					/* 0x1CD - 0x1CE */
+#define RMM_GTSI_DELEGATE_RANGE		SMC64_RMMD_EL3_FID(U(0x1D))
+#define RMM_GTSI_UNDELEGATE_RANGE	SMC64_RMMD_EL3_FID(U(0x1E))
+
 /* ECC Curve types for attest key generation */
 #define ATTEST_KEY_CURVE_ECC_SECP384R1		0
 
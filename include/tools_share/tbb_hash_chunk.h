@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef TBB_HASH_CHUNK_H
+#define TBB_HASH_CHUNK_H
+
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * With TBB_HASH_CHUNK_SIZE set, the image hash in a content certificate is
+ * computed over a header followed by the SHA-256 digests of every chunk of
+ * the image (the last chunk may be shorter):
+ *
+ *   "TBBCHNK1" | chunk size (le32) | image length (le32) | digest[0] | ...
+ *
+ * Every image is hashed this way, whatever its size, and the header binds
+ * the digest list to the hashing mode, the chunk size and the image length.
+ * Neither an image whose bytes happen to be a digest list nor the same image
+ * chunked differently can therefore match the certificate.
+ */
+#define TBB_HASH_CHUNK_MAGIC		"TBBCHNK1"
+#define TBB_HASH_CHUNK_MAGIC_SIZE	8U
+#define TBB_HASH_CHUNK_HDR_SIZE		16U
+#define TBB_HASH_CHUNK_DIGEST_SIZE	32U
+
+static inline void tbb_hash_chunk_put_le32(unsigned char *p, uint32_t v)
+{
+	p[0] = (unsigned char)v;
+	p[1] = (unsigned char)(v >> 8);
+	p[2] = (unsigned char)(v >> 16);
+	p[3] = (unsigned char)(v >> 24);
+}
+
+static inline void tbb_hash_chunk_hdr(unsigned char *hdr, uint32_t chunk_size,
+				      uint32_t image_len)
+{
+	memcpy(hdr, TBB_HASH_CHUNK_MAGIC, TBB_HASH_CHUNK_MAGIC_SIZE);
+	tbb_hash_chunk_put_le32(hdr + 8, chunk_size);
+	tbb_hash_chunk_put_le32(hdr + 12, image_len);
+}
+
+#endif /* TBB_HASH_CHUNK_H */
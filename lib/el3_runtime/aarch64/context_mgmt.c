@@ -31,6 +31,8 @@
 #include <lib/extensions/sys_reg_trace.h>
 #include <lib/extensions/trbe.h>
 #include <lib/extensions/trf.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <lib/utils.h>
 
 #if ENABLE_FEAT_TWED
@@ -1348,6 +1350,14 @@ void cm_el1_sysregs_context_save(uint32_t security_state)
 	ctx = cm_get_context(security_state);
 	assert(ctx != NULL);
 
+#if IMAGE_BL31 && ENABLE_RUNTIME_INSTRUMENTATION
+	if (security_state == NON_SECURE) {
+		PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		    RT_INSTR_ENTER_WORLD_SWITCH,
+		    PMF_NO_CACHE_MAINT);
+	}
+#endif
+
 	el1_sysregs_context_save(get_el1_sysregs_ctx(ctx));
 
 #if IMAGE_BL31
@@ -1367,6 +1377,14 @@ void cm_el1_sysregs_context_restore(uint32_t security_state)
 
 	el1_sysregs_context_restore(get_el1_sysregs_ctx(ctx));
 
+#if IMAGE_BL31 && ENABLE_RUNTIME_INSTRUMENTATION
+	if (security_state == NON_SECURE) {
+		PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+		    RT_INSTR_EXIT_WORLD_SWITCH,
+		    PMF_NO_CACHE_MAINT);
+	}
+#endif
+
 #if IMAGE_BL31
 	if (security_state == SECURE)
 		PUBLISH_EVENT(cm_entering_secure_world);
@@ -14,6 +14,11 @@
 #include <plat/common/platform.h>
 #include <platform_def.h>
 
+#ifdef PLAT_FCONF_INDEX_NODES
+/* Index of the last DTB populated from, see fdtw_index_init() */
+static struct fdtw_index_node fconf_index[PLAT_FCONF_INDEX_NODES];
+#endif
+
 int fconf_load_config(unsigned int image_id)
 {
 	int err;
@@ -59,6 +64,13 @@ void fconf_populate(const char *config_type, uintptr_t config)
 
 	INFO("FCONF: Reading %s firmware configuration file from: 0x%lx\n", config_type, config);
 
+#ifdef PLAT_FCONF_INDEX_NODES
+	if (fdtw_index_init((void *)config, fconf_index,
+			    PLAT_FCONF_INDEX_NODES) < 0) {
+		VERBOSE("FCONF: %s not indexed\n", config_type);
+	}
+#endif
+
 	/* Go through all registered populate functions */
 	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_START__, start);
 	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_END__, end);
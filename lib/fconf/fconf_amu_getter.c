@@ -87,7 +87,7 @@ static int fconf_populate_amu_cpu(const void *fdt, int node, uintptr_t mpidr)
 		return ret;
 	}
 
-	node = fdt_node_offset_by_phandle(fdt, amu_phandle);
+	node = fdtw_node_offset_by_phandle(fdt, amu_phandle);
 	if (node < 0) {
 		return node;
 	}
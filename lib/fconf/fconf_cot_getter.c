@@ -198,7 +198,7 @@ static int get_oid(const void *dtb, int node, const char *prop, char **oid)
 		return rc;
 	}
 
-	node = fdt_node_offset_by_phandle(dtb, phandle);
+	node = fdtw_node_offset_by_phandle(dtb, phandle);
 	if (node < 0) {
 		return node;
 	}
@@ -297,7 +297,7 @@ static int get_parent_img_id(const void *dtb, int node,
 		return err;
 	}
 
-	node = fdt_node_offset_by_phandle(dtb, phandle);
+	node = fdtw_node_offset_by_phandle(dtb, phandle);
 	if (node < 0) {
 		ERROR("FCONF: Failed to locate node using its phandle\n");
 		return node;
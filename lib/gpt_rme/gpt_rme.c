@@ -960,19 +960,6 @@ int gpt_runtime_init(void)
  */
 static spinlock_t gpt_lock;
 
-/*
- * A helper to write the value (target_pas << gpi_shift) to the index of
- * the gpt_l1_addr
- */
-static inline void write_gpt(uint64_t *gpt_l1_desc, uint64_t *gpt_l1_addr,
-			     unsigned int gpi_shift, unsigned int idx,
-			     unsigned int target_pas)
-{
-	*gpt_l1_desc &= ~(GPT_L1_GRAN_DESC_GPI_MASK << gpi_shift);
-	*gpt_l1_desc |= ((uint64_t)target_pas << gpi_shift);
-	gpt_l1_addr[idx] = *gpt_l1_desc;
-}
-
 /*
  * Helper to retrieve the gpt_l1_* information from the base address
  * returned in gpi_info
@@ -1000,18 +987,134 @@ static int get_gpi_params(uint64_t base, gpi_info_t *gpi_info)
 	return 0;
 }
 
+/*
+ * Helper returning the number of granules of the range [pa, end) covered by
+ * the L1 descriptor of pa, and in *mask the GPI fields they use.
+ */
+static unsigned int gpt_l1_desc_range(uint64_t pa, uint64_t end,
+				      uint64_t *mask)
+{
+	unsigned int first = GPT_L1_GPI_IDX(gpt_config.p, pa);
+	unsigned int count = GPT_L1_GPI_IDX_MASK + 1U - first;
+
+	if (((end - pa) >> gpt_config.p) < count) {
+		count = (unsigned int)((end - pa) >> gpt_config.p);
+	}
+
+	if (count == (GPT_L1_GPI_IDX_MASK + 1U)) {
+		*mask = UINT64_MAX;
+	} else {
+		*mask = ((1ULL << (count << 2)) - 1ULL) << (first << 2);
+	}
+
+	return count;
+}
+
+/*
+ * Helper checking that all the granules of [base, base + size) are covered
+ * by L1 tables and have the GPI 'gpi', so that a range transition either
+ * happens in full or not at all.
+ */
+static int gpt_check_range(uint64_t base, size_t size, unsigned int gpi)
+{
+	gpi_info_t gpi_info;
+	uint64_t pa, end = base + size, mask, diff;
+	unsigned int count, first;
+	int res;
+
+	for (pa = base; pa < end; pa += (uint64_t)count << gpt_config.p) {
+		res = get_gpi_params(pa, &gpi_info);
+		if (res != 0) {
+			return res;
+		}
+
+		count = gpt_l1_desc_range(pa, end, &mask);
+		diff = (gpi_info.gpt_l1_desc ^ GPT_BUILD_L1_DESC(gpi)) & mask;
+		if (diff != 0UL) {
+			/* Report the first granule in the wrong state */
+			first = (unsigned int)__builtin_ctzll(diff) >> 2;
+			VERBOSE("[GPT] Granule 0x%" PRIx64 " has GPI %u, expected %u\n",
+				(pa & ~((GPT_PGS_ACTUAL_SIZE(gpt_config.p) << 4) -
+					1UL)) + ((uint64_t)first << gpt_config.p),
+				(unsigned int)((gpi_info.gpt_l1_desc >> (first << 2)) &
+					       GPT_L1_GRAN_DESC_GPI_MASK), gpi);
+			return -EPERM;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Helper setting the GPI of all the granules of [base, base + size), which
+ * must have been checked with gpt_check_range(). L1 descriptors entirely
+ * within the range are written in one go.
+ */
+static void gpt_set_range(uint64_t base, size_t size, unsigned int gpi)
+{
+	uint64_t *gpt_l1_addr;
+	uint64_t pa, end = base + size, mask;
+	unsigned int count, idx;
+
+	for (pa = base; pa < end; pa += (uint64_t)count << gpt_config.p) {
+		gpt_l1_addr = GPT_L0_TBLD_ADDR(((uint64_t *)
+				gpt_config.plat_gpt_l0_base)[GPT_L0_IDX(pa)]);
+		idx = GPT_L1_IDX(gpt_config.p, pa);
+
+		count = gpt_l1_desc_range(pa, end, &mask);
+		gpt_l1_addr[idx] = (gpt_l1_addr[idx] & ~mask) |
+				   (GPT_BUILD_L1_DESC(gpi) & mask);
+	}
+}
+
+/*
+ * log2 of the size of the naturally aligned block invalidated by each range
+ * size encoding of TLBI RPALOS, from 4KB to 512GB.
+ */
+static const uint8_t gpt_tlbi_rpa_shifts[] = {
+	12U, 14U, 16U, 21U, 25U, 29U, 30U, 34U, 36U, 39U
+};
+
+/*
+ * Helper invalidating the GPT information of [base, base + size) with a single
+ * TLBI RPALOS, using the smallest range size encoding whose naturally aligned
+ * block covers the whole range. Ranges which do not fit in a 512GB block fall
+ * back to TLBI PAALLOS.
+ */
+static void gpt_tlbi_range(uint64_t base, size_t size)
+{
+	uint64_t diff = base ^ (base + size - 1UL);
+	unsigned int enc, shift;
+
+	for (enc = 0U; enc < ARRAY_SIZE(gpt_tlbi_rpa_shifts); enc++) {
+		shift = gpt_tlbi_rpa_shifts[enc];
+		if ((diff >> shift) == 0UL) {
+			base &= ~((1UL << shift) - 1UL);
+			tlbirpalos(GPT_TLBI_RPA_OP(enc, base));
+			dsbsy();
+			return;
+		}
+	}
+
+	tlbipaallos();
+	dsbsy();
+}
+
 /*
  * This function is the granule transition delegate service. When a granule
  * transition request occurs it is routed to this function to have the request,
  * if valid, fulfilled following A1.1.1 Delegate of RME supplement
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * A range of granules is transitioned under a single lock, with a single
+ * cache maintenance and TLB invalidation pass, and only if all of them are
+ * in the NS state. The range is limited to GPT_TRANSITION_MAX_SIZE, so that
+ * the lock is not held for an unbounded time.
  *
  * Parameters
  *   base		Base address of the region to transition, must be
  *			aligned to granule size.
  *   size		Size of region to transition, must be aligned to granule
- *			size.
+ *			size and at most GPT_TRANSITION_MAX_SIZE.
  *   src_sec_state	Security state of the caller.
  *
  * Return
@@ -1019,7 +1122,6 @@ static int get_gpi_params(uint64_t base, gpi_info_t *gpi_info)
  */
 int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 {
-	gpi_info_t gpi_info;
 	uint64_t nse;
 	int res;
 	unsigned int target_pas;
@@ -1034,11 +1136,6 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	assert(src_sec_state == SMC_FROM_REALM ||
 	       src_sec_state == SMC_FROM_SECURE);
 
-	/* See if this is a single or a range of granule transition. */
-	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
-		return -EINVAL;
-	}
-
 	/* Check that base and size are valid */
 	if ((ULONG_MAX - base) < size) {
 		VERBOSE("[GPT] Transition request address overflow!\n");
@@ -1050,7 +1147,7 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	/* Make sure base and size are valid. */
 	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1)) != 0UL) ||
 	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1)) != 0UL) ||
-	    (size == 0UL) ||
+	    (size == 0UL) || (size > GPT_TRANSITION_MAX_SIZE) ||
 	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
 		VERBOSE("[GPT] Invalid granule transition address range!\n");
 		VERBOSE("      Base=0x%" PRIx64 "\n", base);
@@ -1069,19 +1166,14 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 * given time.
 	 */
 	spin_lock(&gpt_lock);
-	res = get_gpi_params(base, &gpi_info);
-	if (res != 0) {
-		spin_unlock(&gpt_lock);
-		return res;
-	}
 
-	/* Check that the current address is in NS state */
-	if (gpi_info.gpi != GPT_GPI_NS) {
+	/* Check that the whole range is in NS state */
+	res = gpt_check_range(base, size, GPT_GPI_NS);
+	if (res != 0) {
 		VERBOSE("[GPT] Only Granule in NS state can be delegated.\n");
-		VERBOSE("      Caller: %u, Current GPI: %u\n", src_sec_state,
-			gpi_info.gpi);
+		VERBOSE("      Caller: %u\n", src_sec_state);
 		spin_unlock(&gpt_lock);
-		return -EPERM;
+		return res;
 	}
 
 	if (src_sec_state == SMC_FROM_SECURE) {
@@ -1095,20 +1187,17 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 * states, remove any data speculatively fetched into the target
 	 * physical address space. Issue DC CIPAPA over address range
 	 */
-	flush_dcache_to_popa_range(nse | base,
-				   GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	flush_dcache_to_popa_range(nse | base, size);
 
-	write_gpt(&gpi_info.gpt_l1_desc, gpi_info.gpt_l1_addr,
-		  gpi_info.gpi_shift, gpi_info.idx, target_pas);
+	gpt_set_range(base, size, target_pas);
 	dsboshst();
 
-	gpt_tlbi_by_pa_ll(base, GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	gpt_tlbi_range(base, size);
 	dsbosh();
 
 	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
 
-	flush_dcache_to_popa_range(nse | base,
-				   GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	flush_dcache_to_popa_range(nse | base, size);
 
 	/* Unlock access to the L1 tables. */
 	spin_unlock(&gpt_lock);
@@ -1117,8 +1206,8 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 * The isb() will be done as part of context
 	 * synchronization when returning to lower EL
 	 */
-	VERBOSE("[GPT] Granule 0x%" PRIx64 ", GPI 0x%x->0x%x\n",
-		base, gpi_info.gpi, target_pas);
+	VERBOSE("[GPT] Granules 0x%" PRIx64 "-0x%" PRIx64 ", GPI 0x%x->0x%x\n",
+		base, base + size - 1UL, GPT_GPI_NS, target_pas);
 
 	return 0;
 }
@@ -1128,13 +1217,14 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
  * transition request occurs it is routed to this function where the request is
  * validated then fulfilled if possible.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * As for gpt_delegate_pas(), a range of granules is only transitioned if all
+ * of them are in the caller's state.
  *
  * Parameters
  *   base		Base address of the region to transition, must be
  *			aligned to granule size.
  *   size		Size of region to transition, must be aligned to granule
- *			size.
+ *			size and at most GPT_TRANSITION_MAX_SIZE.
  *   src_sec_state	Security state of the caller.
  *
  * Return
@@ -1142,9 +1232,9 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
  */
 int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 {
-	gpi_info_t gpi_info;
 	uint64_t nse;
 	int res;
+	unsigned int gpi;
 
 	/* Ensure that the tables have been set up before taking requests. */
 	assert(gpt_config.plat_gpt_l0_base != 0UL);
@@ -1156,11 +1246,6 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	assert(src_sec_state == SMC_FROM_REALM ||
 	       src_sec_state == SMC_FROM_SECURE);
 
-	/* See if this is a single or a range of granule transition. */
-	if (size != GPT_PGS_ACTUAL_SIZE(gpt_config.p)) {
-		return -EINVAL;
-	}
-
 	/* Check that base and size are valid */
 	if ((ULONG_MAX - base) < size) {
 		VERBOSE("[GPT] Transition request address overflow!\n");
@@ -1172,7 +1257,7 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	/* Make sure base and size are valid. */
 	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1)) != 0UL) ||
 	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1)) != 0UL) ||
-	    (size == 0UL) ||
+	    (size == 0UL) || (size > GPT_TRANSITION_MAX_SIZE) ||
 	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
 		VERBOSE("[GPT] Invalid granule transition address range!\n");
 		VERBOSE("      Base=0x%" PRIx64 "\n", base);
@@ -1180,6 +1265,11 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 		return -EINVAL;
 	}
 
+	gpi = GPT_GPI_REALM;
+	if (src_sec_state == SMC_FROM_SECURE) {
+		gpi = GPT_GPI_SECURE;
+	}
+
 	/*
 	 * Access to L1 tables is controlled by a global lock to ensure
 	 * that no more than one CPU is allowed to make changes at any
@@ -1187,35 +1277,24 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 */
 	spin_lock(&gpt_lock);
 
-	res = get_gpi_params(base, &gpi_info);
+	/* Check that the whole range is in the delegated state */
+	res = gpt_check_range(base, size, gpi);
 	if (res != 0) {
-		spin_unlock(&gpt_lock);
-		return res;
-	}
-
-	/* Check that the current address is in the delegated state */
-	if ((src_sec_state == SMC_FROM_REALM  &&
-	     gpi_info.gpi != GPT_GPI_REALM) ||
-	    (src_sec_state == SMC_FROM_SECURE &&
-	     gpi_info.gpi != GPT_GPI_SECURE)) {
 		VERBOSE("[GPT] Only Granule in REALM or SECURE state can be undelegated.\n");
-		VERBOSE("      Caller: %u, Current GPI: %u\n", src_sec_state,
-			gpi_info.gpi);
+		VERBOSE("      Caller: %u\n", src_sec_state);
 		spin_unlock(&gpt_lock);
-		return -EPERM;
+		return res;
 	}
 
-
 	/* In order to maintain mutual distrust between Realm and Secure
 	 * states, remove access now, in order to guarantee that writes
 	 * to the currently-accessible physical address space will not
 	 * later become observable.
 	 */
-	write_gpt(&gpi_info.gpt_l1_desc, gpi_info.gpt_l1_addr,
-		  gpi_info.gpi_shift, gpi_info.idx, GPT_GPI_NO_ACCESS);
+	gpt_set_range(base, size, GPT_GPI_NO_ACCESS);
 	dsboshst();
 
-	gpt_tlbi_by_pa_ll(base, GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	gpt_tlbi_range(base, size);
 	dsbosh();
 
 	if (src_sec_state == SMC_FROM_SECURE) {
@@ -1225,8 +1304,7 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	}
 
 	/* Ensure that the scrubbed data has made it past the PoPA */
-	flush_dcache_to_popa_range(nse | base,
-				   GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	flush_dcache_to_popa_range(nse | base, size);
 
 	/*
 	 * Remove any data loaded speculatively
@@ -1234,16 +1312,14 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 */
 	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
 
-	flush_dcache_to_popa_range(nse | base,
-				   GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	flush_dcache_to_popa_range(nse | base, size);
 
-	/* Clear existing GPI encoding and transition granule. */
-	write_gpt(&gpi_info.gpt_l1_desc, gpi_info.gpt_l1_addr,
-		  gpi_info.gpi_shift, gpi_info.idx, GPT_GPI_NS);
+	/* Clear existing GPI encoding and transition granules. */
+	gpt_set_range(base, size, GPT_GPI_NS);
 	dsboshst();
 
 	/* Ensure that all agents observe the new NS configuration */
-	gpt_tlbi_by_pa_ll(base, GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+	gpt_tlbi_range(base, size);
 	dsbosh();
 
 	/* Unlock access to the L1 tables. */
@@ -1253,8 +1329,8 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 	 * The isb() will be done as part of context
 	 * synchronization when returning to lower EL
 	 */
-	VERBOSE("[GPT] Granule 0x%" PRIx64 ", GPI 0x%x->0x%x\n",
-		base, gpi_info.gpi, GPT_GPI_NS);
+	VERBOSE("[GPT] Granules 0x%" PRIx64 "-0x%" PRIx64 ", GPI 0x%x->0x%x\n",
+		base, base + size - 1UL, gpi, GPT_GPI_NS);
 
 	return 0;
 }
@@ -53,6 +53,14 @@
 					 ((uint64_t)(_gpi) << 4*14) | \
 					 ((uint64_t)(_gpi) << 4*15))
 
+/* TLBI RPALOS operand: range size encoding and 4KB aligned base address */
+#define GPT_TLBI_RPA_SIZE_SHIFT		U(44)
+#define GPT_TLBI_RPA_ADDR_MASK		ULL(0xFFFFFFFFFF)
+#define GPT_TLBI_RPA_OP(_enc, _pa)	(((uint64_t)(_enc) <<		\
+					  GPT_TLBI_RPA_SIZE_SHIFT) |	\
+					 (((uint64_t)(_pa) >> U(12)) &	\
+					  GPT_TLBI_RPA_ADDR_MASK))
+
 /******************************************************************************/
 /* GPT platform configuration                                                 */
 /******************************************************************************/
@@ -6,6 +6,10 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <stdint.h>
+
+/* Word type allowed to alias the buffers being compared. */
+typedef uintptr_t __attribute__((__may_alias__)) word_t;
 
 int memcmp(const void *s1, const void *s2, size_t len)
 {
@@ -14,6 +18,28 @@ int memcmp(const void *s1, const void *s2, size_t len)
 	unsigned char sc;
 	unsigned char dc;
 
+	/*
+	 * Skip equal words when both pointers can be aligned at once, and
+	 * leave the first difference to the bytewise loop below.
+	 */
+	if ((((uintptr_t)s ^ (uintptr_t)d) & (sizeof(word_t) - 1U)) == 0U) {
+		while ((len != 0U) &&
+		       (((uintptr_t)s & (sizeof(word_t) - 1U)) != 0U)) {
+			sc = *s++;
+			dc = *d++;
+			if (sc - dc)
+				return (sc - dc);
+			len--;
+		}
+
+		while ((len >= sizeof(word_t)) &&
+		       (*(const word_t *)s == *(const word_t *)d)) {
+			s += sizeof(word_t);
+			d += sizeof(word_t);
+			len -= sizeof(word_t);
+		}
+	}
+
 	while (len--) {
 		sc = *s++;
 		dc = *d++;
@@ -6,12 +6,34 @@
 
 #include <stddef.h>
 #include <string.h>
+#include <stdint.h>
+
+/* Word type allowed to alias the buffers being copied. */
+typedef uintptr_t __attribute__((__may_alias__)) word_t;
 
 void *memcpy(void *dst, const void *src, size_t len)
 {
 	const char *s = src;
 	char *d = dst;
 
+	/*
+	 * Copy whole words when both pointers can be aligned at once. Strict
+	 * alignment may be enforced, so other copies are done byte-per-byte.
+	 */
+	if ((((uintptr_t)d ^ (uintptr_t)s) & (sizeof(word_t) - 1U)) == 0U) {
+		while ((len != 0U) &&
+		       (((uintptr_t)d & (sizeof(word_t) - 1U)) != 0U)) {
+			*d++ = *s++;
+			len--;
+		}
+
+		for (; len >= sizeof(word_t); len -= sizeof(word_t)) {
+			*(word_t *)d = *(const word_t *)s;
+			d += sizeof(word_t);
+			s += sizeof(word_t);
+		}
+	}
+
 	while (len--)
 		*d++ = *s++;
 
@@ -5,6 +5,10 @@
  */
 
 #include <string.h>
+#include <stdint.h>
+
+/* Word type allowed to alias the buffers being copied. */
+typedef uintptr_t __attribute__((__may_alias__)) word_t;
 
 void *memmove(void *dst, const void *src, size_t len)
 {
@@ -17,13 +21,30 @@ void *memmove(void *dst, const void *src, size_t len)
 	 * behaviour and a bug anyway.
 	 */
 	if ((size_t)dst - (size_t)src >= len) {
-		/* destination not in source data, so can safely use memcpy */
+		/*
+		 * destination not in source data, or below it, so can safely
+		 * use memcpy, which copies forwards
+		 */
 		return memcpy(dst, src, len);
 	} else {
-		/* copy backwards... */
+		/* copy backwards, a word at a time when alignment allows */
 		const char *end = dst;
 		const char *s = (const char *)src + len;
 		char *d = (char *)dst + len;
+
+		if ((((uintptr_t)d ^ (uintptr_t)s) &
+		     (sizeof(word_t) - 1U)) == 0U) {
+			while ((d != end) &&
+			       (((uintptr_t)d & (sizeof(word_t) - 1U)) != 0U))
+				*--d = *--s;
+
+			while ((size_t)(d - end) >= sizeof(word_t)) {
+				d -= sizeof(word_t);
+				s -= sizeof(word_t);
+				*(word_t *)d = *(const word_t *)s;
+			}
+		}
+
 		while (d != end)
 			*--d = *--s;
 	}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include <arch_helpers.h>
+#include <lib/ticket_lock.h>
+
+/*
+ * The previous release may have been done by a CPU that was no longer
+ * participating in coherency, so clean and invalidate (or just invalidate)
+ * the owner line before reading it, as bakery_lock_normal.c does.
+ */
+static inline uint32_t read_owner(ticket_lock_t *lock, bool is_cached)
+{
+	if (is_cached) {
+		dccivac((uintptr_t)&lock->owner);
+	} else {
+		dcivac((uintptr_t)&lock->owner);
+	}
+
+	dmbish();
+
+	return lock->owner;
+}
+
+void ticket_lock_get(ticket_lock_t *lock)
+{
+	uint32_t my_ticket;
+
+	/*
+	 * Exclusive accesses need the lock to be in cacheable memory. On warm
+	 * boot this relies on WARMBOOT_ENABLE_DCACHE_EARLY, which the build
+	 * enforces for PSCI_TICKET_LOCK.
+	 */
+	assert(is_dcache_enabled());
+
+	my_ticket = ticket_lock_take(&lock->next);
+
+	/* Releases are followed by an event, wait for our turn */
+	while (read_owner(lock, true) != my_ticket) {
+		wfe();
+	}
+
+	/*
+	 * Lock acquired. Ensure that any reads and writes from a shared
+	 * resource in the critical section read/write values after the lock is
+	 * acquired.
+	 */
+	dmbish();
+}
+
+void ticket_lock_release(ticket_lock_t *lock)
+{
+	bool is_cached = is_dcache_enabled();
+
+	/*
+	 * Ensure that other observers see any stores in the critical section
+	 * before releasing the lock. Also ensure all loads in the critical
+	 * section are complete before releasing the lock.
+	 */
+	dmbish();
+
+	/*
+	 * Only the holder writes 'owner', and the line is never left dirty in
+	 * a cache, so it can be updated with or without the data cache.
+	 */
+	lock->owner = read_owner(lock, is_cached) + 1U;
+
+	if (is_cached) {
+		dccvac((uintptr_t)&lock->owner);
+	} else {
+		dcivac((uintptr_t)&lock->owner);
+	}
+
+	dsbish();
+	sev();
+}
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+
+#include <arch_helpers.h>
+#include <lib/boot_time.h>
+#include <lib/pmf/pmf.h>
+#include <plat/common/platform.h>
+
+#ifdef IMAGE_BL31
+PMF_REGISTER_SERVICE_SMC(boot_time_svc, PMF_BOOT_TIME_SVC_ID,
+	BOOT_TIME_TOTAL_IDS, PMF_STORE_ENABLE)
+#else
+PMF_REGISTER_SERVICE(boot_time_svc, PMF_BOOT_TIME_SVC_ID,
+	BOOT_TIME_TOTAL_IDS, PMF_STORE_ENABLE)
+#endif
+
+/*
+ * In BL2 this is filled by boot_time_export() and passed to BL31. In BL31 only
+ * the I/O statistics are used, the timestamps go to the PMF memory.
+ */
+struct boot_time_handoff boot_time_handoff __aligned(CACHE_WRITEBACK_GRANULE);
+
+void boot_time_capture_img(unsigned int image_id, unsigned int event)
+{
+	if (image_id >= BOOT_TIME_MAX_IMAGES) {
+		return;
+	}
+
+	BOOT_TIME_CAPTURE(BOOT_TIME_IMG_TID(image_id, event));
+}
+
+void boot_time_set_img_bytes(unsigned int image_id, unsigned long long bytes)
+{
+	if (image_id >= BOOT_TIME_MAX_IMAGES) {
+		return;
+	}
+
+	PMF_WRITE_TIMESTAMP(boot_time_svc,
+			    BOOT_TIME_IMG_TID(image_id, BOOT_TIME_IMG_BYTES),
+			    PMF_CACHE_MAINT, bytes);
+}
+
+void boot_time_account_io(unsigned int backend, size_t bytes)
+{
+	if (backend >= BOOT_PROFILE_IO_MAX) {
+		return;
+	}
+
+	boot_time_handoff.io[backend].bytes += bytes;
+}
+
+void boot_time_account_io_errors(unsigned int backend, unsigned int retries,
+				 unsigned int ecc_corrected,
+				 unsigned int ecc_failed)
+{
+	struct boot_profile_io *io;
+
+	if (backend >= BOOT_PROFILE_IO_MAX) {
+		return;
+	}
+
+	io = &boot_time_handoff.io[backend];
+	io->retries += retries;
+	io->ecc_corrected += ecc_corrected;
+	io->ecc_failed += ecc_failed;
+}
+
+#ifdef IMAGE_BL2
+/*
+ * Copy the table of the calling CPU to boot_time_handoff, from where the
+ * platform passes it to BL31. Called right before BL2 exits.
+ */
+void boot_time_export(void)
+{
+	unsigned int tid;
+
+	for (tid = 0U; tid < BOOT_TIME_TOTAL_IDS; tid++) {
+		PMF_GET_TIMESTAMP_BY_INDEX(boot_time_svc, tid,
+					   plat_my_core_pos(),
+					   PMF_NO_CACHE_MAINT,
+					   boot_time_handoff.ts[tid]);
+	}
+
+	flush_dcache_range((uintptr_t)&boot_time_handoff,
+			   sizeof(boot_time_handoff));
+}
+#endif /* IMAGE_BL2 */
+
+#ifdef IMAGE_BL31
+#define BOOT_TIME_IO_WORDS	\
+	((BOOT_PROFILE_IO_MAX * sizeof(struct boot_profile_io)) / \
+	 sizeof(unsigned long long))
+
+/* CPU holding the timestamps passed by BL2 */
+static unsigned int boot_time_cpu;
+
+/*
+ * Store the timestamps passed by BL2 as those of the calling CPU, and take
+ * over its I/O statistics. Meant to be called from the early platform setup,
+ * while the BL2 memory is still intact.
+ */
+void boot_time_import(uintptr_t handoff, size_t size)
+{
+	const volatile unsigned long long *src = (const void *)handoff;
+	unsigned long long *io = (unsigned long long *)boot_time_handoff.io;
+	unsigned int i, tid;
+
+	if ((handoff == 0U) || ((handoff % sizeof(*src)) != 0U) ||
+	    (size != sizeof(struct boot_time_handoff))) {
+		return;
+	}
+
+	boot_time_cpu = plat_my_core_pos();
+
+	/* Word accesses only, this may run with the MMU off */
+	for (tid = 0U; tid < BOOT_TIME_TOTAL_IDS; tid++) {
+		PMF_WRITE_TIMESTAMP(boot_time_svc, tid, PMF_NO_CACHE_MAINT,
+				    (unsigned long long)src[tid]);
+	}
+
+	for (i = 0U; i < BOOT_TIME_IO_WORDS; i++) {
+		io[i] = src[BOOT_TIME_TOTAL_IDS + i];
+	}
+}
+
+static unsigned long long boot_time_get(unsigned int tid)
+{
+	unsigned long long ts;
+
+	PMF_GET_TIMESTAMP_BY_INDEX(boot_time_svc, tid, boot_time_cpu,
+				   PMF_NO_CACHE_MAINT, ts);
+
+	return ts;
+}
+
+/* Time between an image event and the next one, 0 if either is missing */
+static uint64_t boot_time_img_delta(unsigned int image_id, unsigned int start)
+{
+	unsigned long long t0, t1;
+
+	t0 = boot_time_get(BOOT_TIME_IMG_TID(image_id, start));
+	t1 = boot_time_get(BOOT_TIME_IMG_TID(image_id, start + 1U));
+
+	if ((t0 == 0ULL) || (t1 < t0)) {
+		return 0U;
+	}
+
+	return t1 - t0;
+}
+
+static bool boot_time_img_recorded(unsigned int image_id)
+{
+	return (boot_time_get(BOOT_TIME_IMG_TID(image_id,
+				BOOT_TIME_IMG_LOAD_START)) != 0ULL) ||
+	       (boot_time_get(BOOT_TIME_IMG_TID(image_id,
+				BOOT_TIME_IMG_AUTH_START)) != 0ULL);
+}
+
+static unsigned int boot_time_img_count(void)
+{
+	unsigned int id, count = 0U;
+
+	for (id = 0U; id < BOOT_TIME_MAX_IMAGES; id++) {
+		if (boot_time_img_recorded(id)) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/* Size of the struct boot_profile filled by boot_time_fill_profile() */
+size_t boot_time_profile_size(void)
+{
+	return sizeof(struct boot_profile) +
+	       (BOOT_TIME_PHASE_IDS * sizeof(uint64_t)) +
+	       (BOOT_PROFILE_IO_MAX * sizeof(struct boot_profile_io)) +
+	       (boot_time_img_count() * sizeof(struct boot_profile_image));
+}
+
+/*
+ * Summarise the boot time table in 'bp', which must provide
+ * boot_time_profile_size() bytes.
+ */
+void boot_time_fill_profile(struct boot_profile *bp)
+{
+	uint64_t *stages = (uint64_t *)(bp + 1);
+	struct boot_profile_io *io = (void *)(stages + BOOT_TIME_PHASE_IDS);
+	struct boot_profile_image *img = (void *)(io + BOOT_PROFILE_IO_MAX);
+	unsigned int i;
+
+	bp->version = BOOT_PROFILE_VERSION;
+	bp->size = (uint32_t)boot_time_profile_size();
+	bp->cntfrq = read_cntfrq_el0();
+	bp->num_stages = BOOT_TIME_PHASE_IDS;
+	bp->num_io = BOOT_PROFILE_IO_MAX;
+	bp->num_images = 0U;
+	bp->reserved = 0U;
+
+	for (i = 0U; i < BOOT_TIME_PHASE_IDS; i++) {
+		stages[i] = boot_time_get(i);
+	}
+
+	for (i = 0U; i < BOOT_PROFILE_IO_MAX; i++) {
+		io[i] = boot_time_handoff.io[i];
+	}
+
+	for (i = 0U; i < BOOT_TIME_MAX_IMAGES; i++) {
+		if (!boot_time_img_recorded(i)) {
+			continue;
+		}
+
+		img->image_id = i;
+		img->reserved = 0U;
+		img->bytes = boot_time_get(BOOT_TIME_IMG_TID(i,
+						BOOT_TIME_IMG_BYTES));
+		img->load_ticks = boot_time_img_delta(i,
+						BOOT_TIME_IMG_LOAD_START);
+		img->auth_ticks = boot_time_img_delta(i,
+						BOOT_TIME_IMG_AUTH_START);
+		img->decomp_ticks = boot_time_img_delta(i,
+						BOOT_TIME_IMG_DECOMP_START);
+		img++;
+		bp->num_images++;
+	}
+}
+#endif /* IMAGE_BL31 */
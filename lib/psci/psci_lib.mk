@@ -31,6 +31,11 @@ else
 PSCI_LIB_SOURCES		+=	lib/locks/bakery/bakery_lock_normal.c
 endif
 
+ifeq (${PSCI_TICKET_LOCK}, 1)
+PSCI_LIB_SOURCES		+=	lib/locks/exclusive/${ARCH}/ticket_lock.S	\
+					lib/locks/ticket/ticket_lock.c
+endif
+
 ifeq (${ENABLE_PSCI_STAT}, 1)
 PSCI_LIB_SOURCES		+=	lib/psci/psci_stat.c
 endif
@@ -16,6 +16,7 @@
 #include <lib/el3_runtime/cpu_data.h>
 #include <lib/psci/psci.h>
 #include <lib/spinlock.h>
+#include <lib/ticket_lock.h>
 
 /*
  * The PSCI capability which are provided by the generic code but does not
@@ -217,12 +218,21 @@ static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
 }
 
 #else /* if HW_ASSISTED_COHERENCY == 0 */
+#if PSCI_TICKET_LOCK
+/*
+ * Use ticket locks for state coordination. They are always acquired with the
+ * data cache enabled, and can be released after the CPU has left coherency.
+ */
+#define DEFINE_PSCI_LOCK(_name)		DEFINE_TICKET_LOCK(_name)
+#define DECLARE_PSCI_LOCK(_name)	DECLARE_TICKET_LOCK(_name)
+#else
 /*
  * Use bakery locks for state coordination as not all PSCI participants are
  * cache coherent.
  */
 #define DEFINE_PSCI_LOCK(_name)		DEFINE_BAKERY_LOCK(_name)
 #define DECLARE_PSCI_LOCK(_name)	DECLARE_BAKERY_LOCK(_name)
+#endif
 
 /* One lock is required per non-CPU power domain node */
 DECLARE_PSCI_LOCK(psci_locks[PSCI_NUM_NON_CPU_PWR_DOMAINS]);
@@ -244,6 +254,17 @@ static inline void psci_dsbish(void)
 	dsbish();
 }
 
+#if PSCI_TICKET_LOCK
+static inline void psci_lock_get(non_cpu_pd_node_t *non_cpu_pd_node)
+{
+	ticket_lock_get(&psci_locks[non_cpu_pd_node->lock_index]);
+}
+
+static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
+{
+	ticket_lock_release(&psci_locks[non_cpu_pd_node->lock_index]);
+}
+#else
 static inline void psci_lock_get(non_cpu_pd_node_t *non_cpu_pd_node)
 {
 	bakery_lock_get(&psci_locks[non_cpu_pd_node->lock_index]);
@@ -253,6 +274,7 @@ static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
 {
 	bakery_lock_release(&psci_locks[non_cpu_pd_node->lock_index]);
 }
+#endif /* PSCI_TICKET_LOCK */
 
 #endif /* HW_ASSISTED_COHERENCY */
 
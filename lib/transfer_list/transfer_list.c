@@ -12,6 +12,65 @@
 #include <lib/transfer_list.h>
 #include <lib/utils_def.h>
 
+/*******************************************************************************
+ * Calculate the byte sum of a memory range
+ * Return byte sum of the range
+ ******************************************************************************/
+static uint8_t byte_sum(const void *addr, size_t size)
+{
+	const uint8_t *b = addr;
+	uint8_t cs = 0;
+	size_t n = 0;
+
+	for (n = 0; n < size; n++) {
+		cs += b[n];
+	}
+
+	return cs;
+}
+
+/*******************************************************************************
+ * Account in the checksum of a transfer list for a change of the bytes of a
+ * range, old_sum being their byte sum before the change. This avoids summing
+ * the whole list again for each update.
+ ******************************************************************************/
+static void transfer_list_adjust_checksum(struct transfer_list_header *tl,
+					  uint8_t old_sum, const void *addr,
+					  size_t size)
+{
+	tl->checksum -= byte_sum(addr, size) - old_sum;
+}
+
+/*******************************************************************************
+ * Set the size of a transfer list, keeping its checksum up to date
+ ******************************************************************************/
+static void transfer_list_set_size(struct transfer_list_header *tl,
+				   uint32_t size)
+{
+	uint8_t cs = byte_sum(&tl->size, sizeof(tl->size));
+
+	tl->size = size;
+	transfer_list_adjust_checksum(tl, cs, &tl->size, sizeof(tl->size));
+}
+
+/*******************************************************************************
+ * Get the 24-bit tag id of a transfer entry
+ ******************************************************************************/
+static uint32_t transfer_list_entry_tag(const struct transfer_list_entry *te)
+{
+	return te->tag_id | ((uint32_t)te->tag_id_hi << 16);
+}
+
+/*******************************************************************************
+ * Set the 24-bit tag id of a transfer entry
+ ******************************************************************************/
+static void transfer_list_entry_set_tag(struct transfer_list_entry *te,
+					uint32_t tag_id)
+{
+	te->tag_id = tag_id & 0xffffU;
+	te->tag_id_hi = (tag_id >> 16) & 0xffU;
+}
+
 void transfer_list_dump(struct transfer_list_header *tl)
 {
 	struct transfer_list_entry *te = NULL;
@@ -34,7 +93,7 @@ void transfer_list_dump(struct transfer_list_header *tl)
 			break;
 		}
 		NOTICE("Entry %d:\n", i++);
-		NOTICE("tag_id     0x%x\n", te->tag_id);
+		NOTICE("tag_id     0x%x\n", transfer_list_entry_tag(te));
 		NOTICE("hdr_size   0x%x\n", te->hdr_size);
 		NOTICE("data_size  0x%x\n", te->data_size);
 		NOTICE("data_addr  0x%lx\n",
@@ -86,6 +145,7 @@ struct transfer_list_header *transfer_list_relocate(
 	uintptr_t new_addr, align_mask, align_off;
 	struct transfer_list_header *new_tl;
 	uint32_t new_max_size;
+	uint8_t cs;
 
 	if (!tl || !addr || max_size == 0) {
 		return NULL;
@@ -108,9 +168,12 @@ struct transfer_list_header *transfer_list_relocate(
 
 	new_tl = (struct transfer_list_header *)new_addr;
 	memmove(new_tl, tl, tl->size);
-	new_tl->max_size = new_max_size;
 
-	transfer_list_update_checksum(new_tl);
+	// only the max size changes
+	cs = byte_sum(&new_tl->max_size, sizeof(new_tl->max_size));
+	new_tl->max_size = new_max_size;
+	transfer_list_adjust_checksum(new_tl, cs, &new_tl->max_size,
+				      sizeof(new_tl->max_size));
 
 	return new_tl;
 }
@@ -216,29 +279,212 @@ struct transfer_list_entry *transfer_list_next(struct transfer_list_header *tl,
 	return te;
 }
 
+/*******************************************************************************
+ * Return size of the data of a tag index
+ ******************************************************************************/
+static size_t transfer_list_index_size(const struct transfer_list_index *idx)
+{
+	return sizeof(*idx) + idx->max_count * sizeof(idx->entries[0]);
+}
+
+/*******************************************************************************
+ * Get the tag index of a transfer list, if it has one matching its entries
+ * Return pointer to the index or NULL if there is none
+ ******************************************************************************/
+static struct transfer_list_index *transfer_list_get_index(
+					struct transfer_list_header *tl)
+{
+	struct transfer_list_entry *te = transfer_list_next(tl, NULL);
+	struct transfer_list_index *idx;
+
+	if (!te || transfer_list_entry_tag(te) != TL_TAG_TL_INDEX ||
+	    te->data_size < sizeof(*idx)) {
+		return NULL;
+	}
+
+	idx = transfer_list_entry_data(te);
+	if (idx->tl_size != tl->size || idx->count > idx->max_count ||
+	    transfer_list_index_size(idx) > te->data_size) {
+		return NULL;
+	}
+
+	return idx;
+}
+
+/*******************************************************************************
+ * Search the tag index for the first record with the specified tag id
+ * Return position of the record, or where it would be inserted
+ ******************************************************************************/
+static unsigned int transfer_list_index_search(
+					const struct transfer_list_index *idx,
+					uint32_t tag_id)
+{
+	unsigned int lo = 0, hi = idx->count, mid;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (idx->entries[mid].tag_id < tag_id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/*******************************************************************************
+ * Insert the record of a transfer entry into a tag index, after the records of
+ * the entries before it
+ * Return true on success or false if the index is full
+ ******************************************************************************/
+static bool transfer_list_index_insert(struct transfer_list_index *idx,
+				       struct transfer_list_header *tl,
+				       struct transfer_list_entry *te)
+{
+	uint32_t tag_id = transfer_list_entry_tag(te);
+	unsigned int i;
+
+	if (tag_id == TL_TAG_EMPTY || tag_id == TL_TAG_TL_INDEX) {
+		// not indexed
+		return true;
+	}
+
+	if (idx->count == idx->max_count) {
+		return false;
+	}
+
+	// entries are inserted in list order, so the entry goes after the
+	// others with the same tag
+	for (i = idx->count;
+	     i > 0 && idx->entries[i - 1].tag_id > tag_id; i--) {
+		idx->entries[i] = idx->entries[i - 1];
+	}
+
+	idx->entries[i].tag_id = tag_id;
+	idx->entries[i].offset = (uintptr_t)te - (uintptr_t)tl;
+	idx->count++;
+
+	return true;
+}
+
+/*******************************************************************************
+ * Record a transfer entry added at the tail of a transfer list in its index
+ ******************************************************************************/
+static void transfer_list_index_add(struct transfer_list_index *idx,
+				    struct transfer_list_header *tl,
+				    struct transfer_list_entry *te)
+{
+	uint8_t cs = byte_sum(idx, transfer_list_index_size(idx));
+
+	idx->tl_size = tl->size;
+
+	if (!transfer_list_index_insert(idx, tl, te)) {
+		// no more room, lookups walk the list from now on
+		idx->tl_size = 0;
+	}
+
+	transfer_list_adjust_checksum(tl, cs, idx,
+				      transfer_list_index_size(idx));
+}
+
+/*******************************************************************************
+ * Rebuild the tag index of a transfer list, if it has one, from its entries.
+ * This catches up with the entries edited in place, but leaves the checksum to
+ * the caller.
+ ******************************************************************************/
+static void transfer_list_index_rebuild(struct transfer_list_header *tl)
+{
+	struct transfer_list_entry *te = transfer_list_next(tl, NULL);
+	struct transfer_list_index *idx;
+
+	if (!te || transfer_list_entry_tag(te) != TL_TAG_TL_INDEX ||
+	    te->data_size < sizeof(*idx)) {
+		return;
+	}
+
+	idx = transfer_list_entry_data(te);
+	if (transfer_list_index_size(idx) > te->data_size) {
+		return;
+	}
+
+	idx->tl_size = tl->size;
+	idx->count = 0;
+
+	while ((te = transfer_list_next(tl, te)) != NULL) {
+		if (!transfer_list_index_insert(idx, tl, te)) {
+			idx->tl_size = 0;
+			break;
+		}
+	}
+}
+
+/*******************************************************************************
+ * Drop the record of a transfer entry from the index of a transfer list
+ ******************************************************************************/
+static void transfer_list_index_rem(struct transfer_list_index *idx,
+				    struct transfer_list_header *tl,
+				    struct transfer_list_entry *te)
+{
+	uint8_t cs = byte_sum(idx, transfer_list_index_size(idx));
+	uint32_t offset = (uintptr_t)te - (uintptr_t)tl;
+	uint32_t tag_id = transfer_list_entry_tag(te);
+	unsigned int i;
+
+	for (i = transfer_list_index_search(idx, tag_id);
+	     i < idx->count && idx->entries[i].tag_id == tag_id; i++) {
+		if (idx->entries[i].offset == offset) {
+			idx->count--;
+			memmove(&idx->entries[i], &idx->entries[i + 1],
+				(idx->count - i) * sizeof(idx->entries[0]));
+			break;
+		}
+	}
+
+	transfer_list_adjust_checksum(tl, cs, idx,
+				      transfer_list_index_size(idx));
+}
+
+/*******************************************************************************
+ * Update the index of a transfer list after the entries following a transfer
+ * entry were moved by mov_dis bytes
+ ******************************************************************************/
+static void transfer_list_index_move(struct transfer_list_index *idx,
+				     struct transfer_list_header *tl,
+				     struct transfer_list_entry *te,
+				     size_t mov_dis)
+{
+	uint8_t cs = byte_sum(idx, transfer_list_index_size(idx));
+	uint32_t offset = (uintptr_t)te - (uintptr_t)tl;
+	unsigned int i;
+
+	for (i = 0; i < idx->count; i++) {
+		if (idx->entries[i].offset > offset) {
+			idx->entries[i].offset += mov_dis;
+		}
+	}
+	idx->tl_size = tl->size;
+
+	transfer_list_adjust_checksum(tl, cs, idx,
+				      transfer_list_index_size(idx));
+}
+
 /*******************************************************************************
  * Calculate the byte sum of a transfer list
  * Return byte sum of the transfer list
  ******************************************************************************/
 static uint8_t calc_byte_sum(const struct transfer_list_header *tl)
 {
-	uint8_t *b = (uint8_t *)tl;
-	uint8_t cs = 0;
-	size_t n = 0;
-
 	if (!tl) {
 		return 0;
 	}
 
-	for (n = 0; n < tl->size; n++) {
-		cs += b[n];
-	}
-
-	return cs;
+	return byte_sum(tl, tl->size);
 }
 
 /*******************************************************************************
- * Update the checksum of a transfer list
+ * Update the checksum of a transfer list, after rebuilding its tag index for
+ * the entries edited in place
  * Return updated checksum of the transfer list
  ******************************************************************************/
 void transfer_list_update_checksum(struct transfer_list_header *tl)
@@ -249,6 +495,8 @@ void transfer_list_update_checksum(struct transfer_list_header *tl)
 		return;
 	}
 
+	transfer_list_index_rebuild(tl);
+
 	cs = calc_byte_sum(tl);
 	cs -= tl->checksum;
 	cs = 256 - cs;
@@ -275,14 +523,17 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 {
 	uintptr_t tl_old_ev, new_ev = 0, old_ev = 0, ru_new_ev;
 	struct transfer_list_entry *dummy_te = NULL;
+	struct transfer_list_index *idx = NULL;
 	size_t gap = 0;
 	size_t mov_dis = 0;
 	size_t sz = 0;
+	uint8_t cs;
 
 	if (!tl || !te) {
 		return false;
 	}
 	tl_old_ev = (uintptr_t)tl + tl->size;
+	idx = transfer_list_get_index(tl);
 
 	// calculate the old and new end of TE
 	// both must be roundup to align with TRANSFER_LIST_GRANULE
@@ -309,8 +560,17 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 		}
 		ru_new_ev = old_ev + mov_dis;
 		memmove((void *)ru_new_ev, (void *)old_ev, tl_old_ev - old_ev);
-		tl->size += mov_dis;
 		gap = ru_new_ev - new_ev;
+
+		// the moved entries keep their byte sum, only the bytes left
+		// in front of them are new to the list
+		tl->checksum -= byte_sum((void *)old_ev, mov_dis);
+		transfer_list_set_size(tl, tl->size + mov_dis);
+
+		// the index comes first, so it was not moved
+		if (idx) {
+			transfer_list_index_move(idx, tl, te, mov_dis);
+		}
 	} else {
 		gap = old_ev - new_ev;
 	}
@@ -318,15 +578,20 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 	if (gap >= sizeof(*dummy_te)) {
 		// create a dummy TE to fill up the gap
 		dummy_te = (struct transfer_list_entry *)new_ev;
-		dummy_te->tag_id = TL_TAG_EMPTY;
-		dummy_te->reserved0 = 0;
+		cs = byte_sum(dummy_te, sizeof(*dummy_te));
+		transfer_list_entry_set_tag(dummy_te, TL_TAG_EMPTY);
 		dummy_te->hdr_size = sizeof(*dummy_te);
 		dummy_te->data_size = gap - sizeof(*dummy_te);
+		transfer_list_adjust_checksum(tl, cs, dummy_te,
+					      sizeof(*dummy_te));
 	}
 
+	cs = byte_sum(&te->data_size, sizeof(te->data_size));
 	te->data_size = new_data_size;
+	transfer_list_adjust_checksum(tl, cs, &te->data_size,
+				      sizeof(te->data_size));
 
-	transfer_list_update_checksum(tl);
+	assert(transfer_list_verify_checksum(tl));
 	return true;
 }
 
@@ -337,12 +602,20 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 bool transfer_list_rem(struct transfer_list_header *tl,
 			struct transfer_list_entry *te)
 {
+	struct transfer_list_index *idx;
+	uint8_t cs;
+
 	if (!tl || !te || (uintptr_t)te > (uintptr_t)tl + tl->size) {
 		return false;
 	}
-	te->tag_id = TL_TAG_EMPTY;
-	te->reserved0 = 0;
-	transfer_list_update_checksum(tl);
+	idx = transfer_list_get_index(tl);
+	if (idx) {
+		transfer_list_index_rem(idx, tl, te);
+	}
+	cs = byte_sum(te, sizeof(*te));
+	transfer_list_entry_set_tag(te, TL_TAG_EMPTY);
+	transfer_list_adjust_checksum(tl, cs, te, sizeof(*te));
+	assert(transfer_list_verify_checksum(tl));
 	return true;
 }
 
@@ -352,19 +625,22 @@ bool transfer_list_rem(struct transfer_list_header *tl,
  * Return pointer to the added transfer entry or NULL on error
  ******************************************************************************/
 struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
-					      uint16_t tag_id,
+					      uint32_t tag_id,
 					      uint32_t data_size,
 					      const void *data)
 {
 	uintptr_t max_tl_ev, tl_ev, ev;
 	struct transfer_list_entry *te = NULL;
+	struct transfer_list_index *idx = NULL;
 	uint8_t *te_data = NULL;
 	size_t sz = 0;
 
-	if (!tl) {
+	if (!tl || (tag_id & ~TL_TAG_ID_MASK) != 0U) {
 		return NULL;
 	}
 
+	idx = transfer_list_get_index(tl);
+
 	max_tl_ev = (uintptr_t)tl + tl->max_size;
 	tl_ev = (uintptr_t)tl + tl->size;
 	ev = tl_ev;
@@ -378,11 +654,9 @@ struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
 	}
 
 	te = (struct transfer_list_entry *)tl_ev;
-	te->tag_id = tag_id;
-	te->reserved0 = 0;
+	transfer_list_entry_set_tag(te, tag_id);
 	te->hdr_size = sizeof(*te);
 	te->data_size = data_size;
-	tl->size += ev - tl_ev;
 
 	if (data) {
 		// get TE data pointer
@@ -393,7 +667,15 @@ struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
 		memmove(te_data, data, data_size);
 	}
 
-	transfer_list_update_checksum(tl);
+	// all the bytes of the new TE are new to the list
+	tl->checksum -= byte_sum(te, ev - tl_ev);
+	transfer_list_set_size(tl, tl->size + (ev - tl_ev));
+
+	if (idx) {
+		transfer_list_index_add(idx, tl, te);
+	}
+
+	assert(transfer_list_verify_checksum(tl));
 
 	return te;
 }
@@ -406,12 +688,13 @@ struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
  ******************************************************************************/
 struct transfer_list_entry *transfer_list_add_with_align(
 					struct transfer_list_header *tl,
-					uint16_t tag_id, uint32_t data_size,
+					uint32_t tag_id, uint32_t data_size,
 					const void *data, uint8_t alignment)
 {
 	struct transfer_list_entry *te = NULL;
 	uintptr_t tl_ev, ev, new_tl_ev;
 	size_t dummy_te_data_sz = 0;
+	uint8_t cs;
 
 	if (!tl) {
 		return NULL;
@@ -437,8 +720,11 @@ struct transfer_list_entry *transfer_list_add_with_align(
 	te = transfer_list_add(tl, tag_id, data_size, data);
 
 	if (alignment > tl->alignment) {
+		cs = tl->alignment;
 		tl->alignment = alignment;
-		transfer_list_update_checksum(tl);
+		transfer_list_adjust_checksum(tl, cs, &tl->alignment,
+					      sizeof(tl->alignment));
+		assert(transfer_list_verify_checksum(tl));
 	}
 
 	return te;
@@ -450,17 +736,80 @@ struct transfer_list_entry *transfer_list_add_with_align(
  * Return pointer to the found transfer entry or NULL on error
  ******************************************************************************/
 struct transfer_list_entry *transfer_list_find(struct transfer_list_header *tl,
-					       uint16_t tag_id)
+					       uint32_t tag_id)
 {
+	struct transfer_list_index *idx = NULL;
 	struct transfer_list_entry *te = NULL;
+	unsigned int i;
+	uint32_t offset;
+
+	// neither empty entries nor the index itself are indexed
+	if (tag_id != TL_TAG_EMPTY && tag_id != TL_TAG_TL_INDEX) {
+		idx = transfer_list_get_index(tl);
+	}
+
+	if (idx) {
+		i = transfer_list_index_search(idx, tag_id);
+		if (i < idx->count && idx->entries[i].tag_id == tag_id) {
+			offset = idx->entries[i].offset;
+			te = (struct transfer_list_entry *)((uintptr_t)tl +
+							    offset);
+			if (offset >= tl->hdr_size &&
+			    is_aligned(offset, TRANSFER_LIST_GRANULE) &&
+			    offset + sizeof(*te) <= tl->size &&
+			    transfer_list_entry_tag(te) == tag_id) {
+				return te;
+			}
+		}
+
+		// the index is out of date, or the tag was set in place and
+		// is missing from it, walk the list instead
+		te = NULL;
+	}
 
 	do {
 		te = transfer_list_next(tl, te);
-	} while (te && (te->tag_id != tag_id || te->reserved0 != 0));
+	} while (te && transfer_list_entry_tag(te) != tag_id);
 
 	return te;
 }
 
+/*******************************************************************************
+ * Add a tag index for up to max_count entries to an empty transfer list, which
+ * transfer_list_find() then searches instead of walking the list. Entries are
+ * added to and removed from the index along with the list.
+ * Return true on success or false on error
+ ******************************************************************************/
+bool transfer_list_add_index(struct transfer_list_header *tl,
+			     uint16_t max_count)
+{
+	struct transfer_list_entry *te = NULL;
+	struct transfer_list_index *idx = NULL;
+	uint8_t cs;
+
+	// the index must be the first entry to be found without a walk
+	if (!tl || transfer_list_next(tl, NULL)) {
+		return false;
+	}
+
+	te = transfer_list_add(tl, TL_TAG_TL_INDEX, sizeof(*idx) +
+			       max_count * sizeof(idx->entries[0]), NULL);
+	if (!te) {
+		return false;
+	}
+
+	idx = transfer_list_entry_data(te);
+	cs = byte_sum(idx, sizeof(*idx));
+	idx->tl_size = tl->size;
+	idx->count = 0;
+	idx->max_count = max_count;
+	transfer_list_adjust_checksum(tl, cs, idx, sizeof(*idx));
+
+	assert(transfer_list_verify_checksum(tl));
+
+	return true;
+}
+
 /*******************************************************************************
  * Retrieve the data pointer of a specified transfer entry
  * Return pointer to the transfer entry data or NULL on error
@@ -119,6 +119,23 @@ void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
 	}
 }
 
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime)
+{
+	assert(IS_PAGE_ALIGNED(va) && IS_PAGE_ALIGNED(size));
+
+	if ((xlat_regime == EL1_EL0_REGIME) &&
+	    ((size >> PAGE_SIZE_SHIFT) > XLAT_TLBI_ALL_THRESHOLD)) {
+		dsbishst();
+		tlbiallis();
+		return;
+	}
+
+	for (; size != 0U; size -= PAGE_SIZE) {
+		xlat_arch_tlbi_va(va, xlat_regime);
+		va += PAGE_SIZE;
+	}
+}
+
 void xlat_arch_tlbi_va_sync(void)
 {
 	/* Invalidate all entries from branch predictors. */
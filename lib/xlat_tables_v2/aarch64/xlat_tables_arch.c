@@ -211,6 +211,86 @@ void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
 	}
 }
 
+/* Invalidate all the TLB entries of the translation regime. */
+static void xlat_arch_tlbi_all(int xlat_regime)
+{
+	if (xlat_regime == EL1_EL0_REGIME) {
+		assert(xlat_arch_current_el() >= 1U);
+		tlbivmalle1is();
+	} else if (xlat_regime == EL2_REGIME) {
+		assert(xlat_arch_current_el() >= 2U);
+		tlbialle2is();
+	} else {
+		assert(xlat_regime == EL3_REGIME);
+		assert(xlat_arch_current_el() >= 3U);
+		tlbialle3is();
+	}
+}
+
+static void xlat_arch_tlbi_range(uint64_t op, int xlat_regime)
+{
+	if (xlat_regime == EL1_EL0_REGIME) {
+		tlbirvaae1is(op);
+	} else if (xlat_regime == EL2_REGIME) {
+		tlbirvae2is(op);
+	} else {
+		tlbirvae3is(op);
+	}
+}
+
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime)
+{
+	uint64_t pages = size >> PAGE_SIZE_SHIFT;
+	bool range = is_feat_tlbirange_present();
+	unsigned int scale;
+
+	assert(IS_PAGE_ALIGNED(va) && IS_PAGE_ALIGNED(size));
+
+	if ((range && (pages >=
+	     TLBI_RANGE_PAGES(TLBI_RANGE_NUM_MASK, TLBI_RANGE_SCALE_MAX))) ||
+	    (!range && (pages > XLAT_TLBI_ALL_THRESHOLD))) {
+		dsbishst();
+		xlat_arch_tlbi_all(xlat_regime);
+		return;
+	}
+
+	if (!range) {
+		for (; pages != 0U; pages--) {
+			xlat_arch_tlbi_va(va, xlat_regime);
+			va += PAGE_SIZE;
+		}
+		return;
+	}
+
+	/*
+	 * A range operand covers an even number of pages, between 2 and 64
+	 * times 2^(5 * scale). Take the bits of the number of pages 5 at a
+	 * time, from the least significant ones, with the last odd page
+	 * invalidated on its own.
+	 */
+	for (scale = 0U; pages != 0U; ) {
+		uint64_t num;
+
+		if ((pages % 2U) != 0U) {
+			xlat_arch_tlbi_va(va, xlat_regime);
+			va += PAGE_SIZE;
+			pages--;
+			continue;
+		}
+
+		num = (pages >> ((5U * scale) + 1U)) & TLBI_RANGE_NUM_MASK;
+		if (num != 0U) {
+			dsbishst();
+			xlat_arch_tlbi_range(TLBI_RANGE_OP(va, num - 1U, scale),
+					     xlat_regime);
+			va += TLBI_RANGE_PAGES(num - 1U, scale) * PAGE_SIZE;
+			pages -= TLBI_RANGE_PAGES(num - 1U, scale);
+		}
+
+		scale++;
+	}
+}
+
 void xlat_arch_tlbi_va_sync(void)
 {
 	/*
@@ -352,7 +352,7 @@ static action_t xlat_tables_unmap_region_action(const mmap_region_t *mm,
 }
 /*
  * Recursive function that writes to the translation tables and unmaps the
- * specified region.
+ * specified region. The caller invalidates the TLB entries of the region.
  */
 static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 				     const uintptr_t table_base_va,
@@ -389,7 +389,6 @@ static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 		if (action == ACTION_WRITE_BLOCK_ENTRY) {
 
 			table_base[table_idx] = INVALID_DESC;
-			xlat_arch_tlbi_va(table_idx_va, ctx->xlat_regime);
 
 		} else if (action == ACTION_RECURSE_INTO_TABLE) {
 
@@ -406,11 +405,8 @@ static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 			/*
 			 * If the subtable is now empty, remove its reference.
 			 */
-			if (xlat_table_is_empty(ctx, subtable)) {
+			if (xlat_table_is_empty(ctx, subtable))
 				table_base[table_idx] = INVALID_DESC;
-				xlat_arch_tlbi_va(table_idx_va,
-						  ctx->xlat_regime);
-			}
 
 		} else {
 			assert(action == ACTION_NONE);
@@ -561,6 +557,76 @@ static action_t xlat_tables_map_region_action(const mmap_region_t *mm,
 	}
 }
 
+#if XLAT_TABLES_CONTIG
+/*
+ * Set the contiguous hint on the aligned groups of CONT_HINT_ENTRIES block or
+ * page descriptors of a table that lie within an MT_CONTIG region and translate
+ * to one aligned output range with the same attributes, so that the TLB can
+ * hold each group as a single entry.
+ *
+ * Adding or removing the hint on live descriptors would need a
+ * break-before-make sequence over the whole group, so this is only done while
+ * creating the tables, and only for the regions whose attributes are never
+ * changed afterwards. Dynamic regions are left out so that they can still be
+ * unmapped one descriptor at a time.
+ */
+static void xlat_tables_set_contig(const xlat_ctx_t *ctx,
+				   const mmap_region_t *mm,
+				   uintptr_t table_base_va,
+				   uint64_t *const table_base,
+				   unsigned int table_entries,
+				   unsigned int level)
+{
+	unsigned long long mm_end_va = mm->base_va + mm->size - 1U;
+	unsigned long long group_size =
+		(unsigned long long)XLAT_BLOCK_SIZE(level) * CONT_HINT_ENTRIES;
+	uint64_t desc_type = (level == XLAT_TABLE_LEVEL_MAX) ?
+			     PAGE_DESC : BLOCK_DESC;
+
+	if (ctx->initialized || (level < MIN_LVL_BLOCK_DESC) ||
+	    ((mm->attr & MT_CONTIG) == 0U))
+		return;
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+	if ((mm->attr & MT_DYNAMIC) != 0U)
+		return;
+#endif
+
+	for (unsigned int idx = 0U; (idx + CONT_HINT_ENTRIES) <= table_entries;
+	     idx += CONT_HINT_ENTRIES) {
+		uintptr_t group_va = table_base_va +
+				     (idx * XLAT_BLOCK_SIZE(level));
+		uint64_t first = table_base[idx];
+		unsigned int i;
+
+		if ((group_va < mm->base_va) ||
+		    ((group_va + group_size - 1U) > mm_end_va))
+			continue;
+
+		if (((first & DESC_MASK) != desc_type) ||
+		    ((first & TABLE_ADDR_MASK & (group_size - 1U)) != 0U))
+			continue;
+
+		/*
+		 * The output addresses are part of the descriptors, so the
+		 * whole group matches if each descriptor is the first one
+		 * advanced by its offset in the group.
+		 */
+		for (i = 1U; i < CONT_HINT_ENTRIES; i++) {
+			if (table_base[idx + i] !=
+			    (first + ((uint64_t)i * XLAT_BLOCK_SIZE(level))))
+				break;
+		}
+
+		if (i != CONT_HINT_ENTRIES)
+			continue;
+
+		for (i = 0U; i < CONT_HINT_ENTRIES; i++)
+			table_base[idx + i] |= UPPER_ATTRS(CONT_HINT);
+	}
+}
+#endif /* XLAT_TABLES_CONTIG */
+
 /*
  * Recursive function that writes to the translation tables and maps the
  * specified region. On success, it returns the VA of the last byte that was
@@ -631,8 +697,10 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 				XLAT_TABLE_ENTRIES * sizeof(uint64_t));
 #endif
 			if (end_va !=
-				(table_idx_va + XLAT_BLOCK_SIZE(level) - 1U))
-				return end_va;
+				(table_idx_va + XLAT_BLOCK_SIZE(level) - 1U)) {
+				table_idx_va = end_va + 1U;
+				break;
+			}
 
 		} else if (action == ACTION_RECURSE_INTO_TABLE) {
 			uintptr_t end_va;
@@ -647,8 +715,10 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 				XLAT_TABLE_ENTRIES * sizeof(uint64_t));
 #endif
 			if (end_va !=
-				(table_idx_va + XLAT_BLOCK_SIZE(level) - 1U))
-				return end_va;
+				(table_idx_va + XLAT_BLOCK_SIZE(level) - 1U)) {
+				table_idx_va = end_va + 1U;
+				break;
+			}
 
 		} else {
 
@@ -664,6 +734,15 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 			break;
 	}
 
+#if XLAT_TABLES_CONTIG
+	/*
+	 * The loop also ends here when the region ends in a subtable, so the
+	 * groups of this table are hinted even if the region isn't aligned.
+	 */
+	xlat_tables_set_contig(ctx, mm, table_base_va, table_base,
+			       table_entries, level);
+#endif
+
 	return table_idx_va - 1U;
 }
 
@@ -1037,6 +1116,9 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 			xlat_clean_dcache_range((uintptr_t)ctx->base_table,
 				ctx->base_table_entries * sizeof(uint64_t));
 #endif
+			xlat_arch_tlbi_va_range(unmap_mm.base_va, unmap_mm.size,
+						ctx->xlat_regime);
+			xlat_arch_tlbi_va_sync();
 			return -ENOMEM;
 		}
 
@@ -1123,6 +1205,12 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx, uintptr_t base_va,
 		xlat_clean_dcache_range((uintptr_t)ctx->base_table,
 			ctx->base_table_entries * sizeof(uint64_t));
 #endif
+		/*
+		 * This also covers the walk cache entries of the tables that
+		 * were freed, as the region overlapped them.
+		 */
+		xlat_arch_tlbi_va_range(mm->base_va, mm->size,
+					ctx->xlat_regime);
 		xlat_arch_tlbi_va_sync();
 	}
 
@@ -1185,6 +1273,49 @@ void xlat_setup_dynamic_ctx(xlat_ctx_t *ctx, unsigned long long pa_max,
 
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
+#if XLAT_TABLES_CONTIG
+static bool mmap_regions_mergeable(const mmap_region_t *mm,
+				   const mmap_region_t *next)
+{
+	if ((mm->attr & MT_CONTIG) == 0U)
+		return false;
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+	if (((mm->attr | next->attr) & MT_DYNAMIC) != 0U)
+		return false;
+#endif
+
+	return ((mm->base_va + mm->size) == next->base_va) &&
+	       ((mm->base_pa + mm->size) == next->base_pa) &&
+	       (mm->attr == next->attr) &&
+	       (mm->granularity == next->granularity);
+}
+
+/*
+ * Merge the static MT_CONTIG regions that follow each other in both VA and PA
+ * and have the same attributes, so that a block boundary between them doesn't force a
+ * finer table. The mmap array stays ordered as mmap_add_region_ctx() expects,
+ * as the merged region ends where the second one did.
+ */
+static void __init mmap_merge_regions(xlat_ctx_t *ctx)
+{
+	mmap_region_t *mm = ctx->mmap;
+
+	/* The last entry of the array is always empty */
+	while ((mm->size != 0U) && (mm[1].size != 0U)) {
+		if (!mmap_regions_mergeable(mm, &mm[1])) {
+			mm++;
+			continue;
+		}
+
+		mm->size += mm[1].size;
+
+		for (mmap_region_t *next = &mm[1]; next->size != 0U; next++)
+			*next = next[1];
+	}
+}
+#endif /* XLAT_TABLES_CONTIG */
+
 void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 {
 	assert(ctx != NULL);
@@ -1201,6 +1332,10 @@ void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 	assert(ctx->va_max_address <= (MAX_VIRT_ADDR_SPACE_SIZE - 1U));
 	assert(IS_POWER_OF_TWO(ctx->va_max_address + 1U));
 
+#if XLAT_TABLES_CONTIG
+	mmap_merge_regions(ctx);
+#endif
+
 	xlat_mmap_print(mm);
 
 	/* All tables must be zeroed before mapping any region. */
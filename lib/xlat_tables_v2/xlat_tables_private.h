@@ -63,8 +63,24 @@ uint64_t xlat_arch_regime_get_xn_desc(int xlat_regime);
 void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime);
 
 /*
- * This function has to be called at the end of any code that uses the function
- * xlat_arch_tlbi_va().
+ * Number of pages above which invalidating the TLB entries of a range one page
+ * at a time is more expensive than invalidating all the entries of the
+ * translation regime. Only used when the range can't be invalidated with the
+ * TLBI range instructions (FEAT_TLBIRANGE).
+ */
+#ifndef XLAT_TLBI_ALL_THRESHOLD
+#define XLAT_TLBI_ALL_THRESHOLD	U(64)
+#endif
+
+/*
+ * Invalidate the TLB entries of all the pages in the page-aligned range
+ * [va, va + size), as xlat_arch_tlbi_va() would for each of them.
+ */
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime);
+
+/*
+ * This function has to be called at the end of any code that uses the
+ * functions xlat_arch_tlbi_va() or xlat_arch_tlbi_va_range().
  */
 void xlat_arch_tlbi_va_sync(void);
 
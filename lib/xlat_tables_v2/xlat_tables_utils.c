@@ -120,6 +120,10 @@ static void xlat_desc_print(const xlat_ctx_t *ctx, uint64_t desc)
 		printf("-GP");
 	}
 #endif
+
+	if ((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+		printf("-CONT");
+	}
 }
 
 static const char * const level_spacers[] = {
@@ -447,8 +451,6 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				   size_t size, uint32_t attr)
 {
-	/* Note: This implementation isn't optimized. */
-
 	assert(ctx != NULL);
 	assert(ctx->initialized);
 
@@ -519,6 +521,18 @@ int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 			return -EINVAL;
 		}
 
+#if XLAT_TABLES_CONTIG
+		/*
+		 * Clearing the contiguous hint would unmap the other pages of
+		 * the group for a while, so MT_CONTIG regions can't be changed.
+		 */
+		if ((desc & UPPER_ATTRS(CONT_HINT)) != 0ULL) {
+			WARN("Address 0x%lx is in a contiguous mapping.\n",
+			     base_va);
+			return -EINVAL;
+		}
+#endif
+
 		/*
 		 * If the region type is device, it shouldn't be executable.
 		 */
@@ -537,52 +551,81 @@ int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 	/* Restore original value. */
 	base_va = base_va_original;
 
-	for (unsigned int i = 0U; i < pages_count; ++i) {
+	/*
+	 * The pages are changed one last level table at a time. The
+	 * break-before-make sequence requires writing invalid descriptors and
+	 * making sure that the system sees the change before writing the new
+	 * descriptors, which is done for all the pages of the table at once:
+	 * meanwhile, the invalid descriptors hold the new ones without their
+	 * type, so the TLB can be invalidated with a single range operation.
+	 */
+	while (pages_count > 0U) {
+		uint64_t *entries = NULL;
+		size_t count = XLAT_TABLE_ENTRIES -
+			       XLAT_TABLE_IDX(base_va, XLAT_TABLE_LEVEL_MAX);
+		size_t i;
 
-		uint32_t old_attr = 0U, new_attr;
-		uint64_t *entry = NULL;
-		unsigned int level = 0U;
-		unsigned long long addr_pa = 0ULL;
+		if (count > pages_count)
+			count = pages_count;
 
-		(void) xlat_get_mem_attributes_internal(ctx, base_va, &old_attr,
-					    &entry, &addr_pa, &level);
+		for (i = 0U; i < count; i++) {
+			uintptr_t va = base_va + (i * PAGE_SIZE);
+			uint32_t old_attr = 0U, new_attr;
+			uint64_t *entry = NULL;
+			unsigned int level = 0U;
+			unsigned long long addr_pa = 0ULL;
 
-		/*
-		 * From attr, only MT_RO/MT_RW, MT_EXECUTE/MT_EXECUTE_NEVER and
-		 * MT_USER/MT_PRIVILEGED are taken into account. Any other
-		 * information is ignored.
-		 */
+			(void) xlat_get_mem_attributes_internal(ctx, va,
+					&old_attr, &entry, &addr_pa, &level);
 
-		/* Clean the old attributes so that they can be rebuilt. */
-		new_attr = old_attr & ~(MT_RW | MT_EXECUTE_NEVER | MT_USER);
+			if (i == 0U)
+				entries = entry;
+			assert(entry == &entries[i]);
 
-		/*
-		 * Update attributes, but filter out the ones this function
-		 * isn't allowed to change.
-		 */
-		new_attr |= attr & (MT_RW | MT_EXECUTE_NEVER | MT_USER);
+			/*
+			 * From attr, only MT_RO/MT_RW,
+			 * MT_EXECUTE/MT_EXECUTE_NEVER and MT_USER/MT_PRIVILEGED
+			 * are taken into account. Any other information is
+			 * ignored.
+			 */
+
+			/*
+			 * Clean the old attributes so that they can be
+			 * rebuilt.
+			 */
+			new_attr = old_attr &
+				   ~(MT_RW | MT_EXECUTE_NEVER | MT_USER);
+
+			/*
+			 * Update attributes, but filter out the ones this
+			 * function isn't allowed to change.
+			 */
+			new_attr |= attr & (MT_RW | MT_EXECUTE_NEVER | MT_USER);
+
+			*entry = xlat_desc(ctx, new_attr, addr_pa, level) &
+				 ~(uint64_t)DESC_MASK;
+		}
 
-		/*
-		 * The break-before-make sequence requires writing an invalid
-		 * descriptor and making sure that the system sees the change
-		 * before writing the new descriptor.
-		 */
-		*entry = INVALID_DESC;
 #if !HW_ASSISTED_COHERENCY
-		dccvac((uintptr_t)entry);
+		clean_dcache_range((uintptr_t)entries,
+				   count * sizeof(uint64_t));
 #endif
-		/* Invalidate any cached copy of this mapping in the TLBs. */
-		xlat_arch_tlbi_va(base_va, ctx->xlat_regime);
+		/* Invalidate any cached copy of these mappings in the TLBs. */
+		xlat_arch_tlbi_va_range(base_va, count * PAGE_SIZE,
+					ctx->xlat_regime);
 
 		/* Ensure completion of the invalidation. */
 		xlat_arch_tlbi_va_sync();
 
-		/* Write new descriptor */
-		*entry = xlat_desc(ctx, new_attr, addr_pa, level);
+		/* Write new descriptors */
+		for (i = 0U; i < count; i++)
+			entries[i] |= PAGE_DESC;
 #if !HW_ASSISTED_COHERENCY
-		dccvac((uintptr_t)entry);
+		clean_dcache_range((uintptr_t)entries,
+				   count * sizeof(uint64_t));
 #endif
-		base_va += PAGE_SIZE;
+		base_va += count * PAGE_SIZE;
+		pages_count -= count;
 	}
 
 	/* Ensure that the last descriptor written is seen by the system. */
@@ -13,6 +13,10 @@
 #include <common/debug.h>
 #include <lib/utils.h>
 #include <tf_unxz.h>
+#ifdef XZ_MULTI_CPU
+#include <plat/common/platform.h>
+#include <platform_def.h>
+#endif
 
 #include "xz.h"
 
@@ -25,9 +29,25 @@ static bool xz_crc64_initialized;
 
 #define XZALLOC_ALIGNMENT	sizeof(void *)
 
-static uintptr_t xzalloc_start;
-static uintptr_t xzalloc_end;
-static uintptr_t xzalloc_current;
+/*
+ * With XZ_MULTI_CPU, unxz() may run on several CPUs at once, each with its
+ * own workspace, so the allocator state is kept per CPU.
+ */
+#ifdef XZ_MULTI_CPU
+#define XZALLOC_CTX_COUNT	PLATFORM_CORE_COUNT
+#define xzalloc_ctx_get()	(&xzalloc_ctx[plat_my_core_pos()])
+#else
+#define XZALLOC_CTX_COUNT	1
+#define xzalloc_ctx_get()	(&xzalloc_ctx[0])
+#endif
+
+struct xzalloc_ctx {
+	uintptr_t start;
+	uintptr_t end;
+	uintptr_t current;
+};
+
+static struct xzalloc_ctx xzalloc_ctx[XZALLOC_CTX_COUNT];
 
 #pragma weak xz_simple_putc
 
@@ -46,37 +66,30 @@ void xz_simple_puts(const char *s)
 
 void *xz_malloc(size_t size)
 {
+	struct xzalloc_ctx *ctx = xzalloc_ctx_get();
 	uintptr_t p, p_end;
 
-	p = round_up(xzalloc_current, XZALLOC_ALIGNMENT);
+	p = round_up(ctx->current, XZALLOC_ALIGNMENT);
 	p_end = p + size;
 
-	if (p_end > xzalloc_end)
+	if (p_end > ctx->end)
 		return NULL;
 
 	memset((void *)p, 0, size);
 
-	xzalloc_current = p_end;
+	ctx->current = p_end;
 
 	return (void *)p;
 }
 
 /*
- * unxz - decompress XZ data
- * @in_buf: source of compressed input. Upon exit, the end of input.
- * @in_len: length of in_buf
- * @out_buf: destination of decompressed output. Upon exit, the end of output.
- * @out_len: length of out_buf
- * @work_buf: workspace
- * @work_len: length of workspace
+ * unxz_init - initialize the shared CRC tables
+ *
+ * Called by unxz() on first use. Callers running unxz() on several CPUs must
+ * call it once beforehand.
  */
-int unxz(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf, size_t out_len,
-	 uintptr_t work_buf, size_t work_len)
+void unxz_init(void)
 {
-	struct xz_dec *xz;
-	struct xz_buf b;
-	enum xz_ret xzret;
-
 #if XZ_INTERNAL_CRC32
 	if (!xz_crc32_initialized) {
 		xz_crc32_init();
@@ -90,10 +103,30 @@ int unxz(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf, size_t out_len,
 		xz_crc64_initialized = true;
 	}
 #endif
+}
+
+/*
+ * unxz - decompress XZ data
+ * @in_buf: source of compressed input. Upon exit, the end of input.
+ * @in_len: length of in_buf
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @work_buf: workspace
+ * @work_len: length of workspace
+ */
+int unxz(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf, size_t out_len,
+	 uintptr_t work_buf, size_t work_len)
+{
+	struct xzalloc_ctx *ctx = xzalloc_ctx_get();
+	struct xz_dec *xz;
+	struct xz_buf b;
+	enum xz_ret xzret;
+
+	unxz_init();
 
-	xzalloc_start = work_buf;
-	xzalloc_end = work_buf + work_len;
-	xzalloc_current = xzalloc_start;
+	ctx->start = work_buf;
+	ctx->end = work_buf + work_len;
+	ctx->current = ctx->start;
 
 	xz = xz_dec_init(XZ_SINGLE, 0);
 	if (!xz) {
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Checksum entry points used by inflate when ZLIB_AARCH64_OPT is enabled.
+ * These replace the table-driven crc32.c and the scalar adler32.c; only the
+ * functions needed by inflate and tf_crc32() are provided.
+ */
+
+#include <arch_features.h>
+#include <arch_helpers.h>
+
+#include "../zutil.h"
+#include "zlib_aarch64.h"
+
+/*
+ * The Advanced SIMD routines clobber the FP/SIMD registers, which only BL1
+ * and BL2 can afford: nothing below them has live FP/SIMD state yet.
+ */
+#if !defined(IMAGE_BL1) && !defined(IMAGE_BL2)
+#error "ZLIB_AARCH64_OPT is only supported in BL1 and BL2"
+#endif
+
+/*
+ * CRC-32 for cores without the optional ARMv8.0 CRC32 instructions, using a
+ * 16-entry table (one nibble at a time) to keep the footprint small.
+ */
+static uint32_t zlib_crc32_nibble(uint32_t crc, const unsigned char *buf,
+				  size_t len)
+{
+	static const uint32_t crc32_tab[16] = {
+		0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+		0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+		0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+		0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c,
+	};
+
+	crc = ~crc;
+	while (len-- != 0U) {
+		crc ^= *buf++;
+		crc = (crc >> 4) ^ crc32_tab[crc & 0xfU];
+		crc = (crc >> 4) ^ crc32_tab[crc & 0xfU];
+	}
+
+	return ~crc;
+}
+
+uLong ZEXPORT crc32_z(uLong crc, const Bytef *buf, z_size_t len)
+{
+	if (buf == Z_NULL)
+		return 0UL;
+
+	if (!is_feat_crc32_present())
+		return zlib_crc32_nibble((uint32_t)crc, buf, len);
+
+	return zlib_crc32_armv8((uint32_t)crc, buf, len);
+}
+
+uLong ZEXPORT crc32(uLong crc, const Bytef *buf, uInt len)
+{
+	return crc32_z(crc, buf, len);
+}
+
+uLong ZEXPORT adler32_z(uLong adler, const Bytef *buf, z_size_t len)
+{
+	if (buf == Z_NULL)
+		return 1UL;
+
+	return zlib_adler32_neon((uint32_t)adler, buf, len);
+}
+
+uLong ZEXPORT adler32(uLong adler, const Bytef *buf, uInt len)
+{
+	return adler32_z(adler, buf, len);
+}
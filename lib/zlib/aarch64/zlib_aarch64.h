@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef ZLIB_AARCH64_H
+#define ZLIB_AARCH64_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Minimum 'out - from' distance for which zlib_chunk_copy() may overlap */
+#define ZLIB_CHUNK_SIZE		16U
+
+unsigned char *zlib_chunk_copy(unsigned char *out, const unsigned char *from,
+			       size_t len);
+uint32_t zlib_crc32_armv8(uint32_t crc, const unsigned char *buf, size_t len);
+uint32_t zlib_adler32_neon(uint32_t adler, const unsigned char *buf,
+			   size_t len);
+
+#endif /* ZLIB_AARCH64_H */
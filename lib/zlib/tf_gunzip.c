@@ -8,6 +8,7 @@
 #include <errno.h>
 #include <string.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <common/tf_crc32.h>
 #include <lib/utils.h>
@@ -62,6 +63,9 @@ int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 {
 	z_stream stream;
 	int zret, ret;
+#if ZLIB_AARCH64_OPT
+	u_register_t cptr;
+#endif
 
 	zalloc_start = work_buf;
 	zalloc_end = work_buf + work_len;
@@ -81,7 +85,14 @@ int gunzip(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
 		return (zret == Z_MEM_ERROR) ? -ENOMEM : -EIO;
 	}
 
+#if ZLIB_AARCH64_OPT
+	/* The AArch64 fast path uses Advanced SIMD, which EL3 traps by default */
+	cptr = fp_trap_el3_disable();
 	zret = inflate(&stream, Z_NO_FLUSH);
+	fp_trap_el3_restore(cptr);
+#else
+	zret = inflate(&stream, Z_NO_FLUSH);
+#endif
 	if (zret == Z_STREAM_END) {
 		ret = 0;
 	} else {
@@ -1,20 +1,41 @@
 #
-# Copyright (c) 2018, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
 ZLIB_PATH	:=	lib/zlib
 
+# Use the AArch64 inflate fast path and checksum routines. They clobber the
+# FP/SIMD registers, so only enable this for BL1/BL2.
+ZLIB_AARCH64_OPT	?=	0
+$(eval $(call assert_boolean,ZLIB_AARCH64_OPT))
+$(eval $(call add_define,ZLIB_AARCH64_OPT))
+
+ifeq (${ARCH},aarch32)
+ifeq (${ZLIB_AARCH64_OPT},1)
+$(error ZLIB_AARCH64_OPT is only supported for AArch64)
+endif
+endif
+
 # Imported from zlib 1.2.11 (do not modify them)
 ZLIB_SOURCES	:=	$(addprefix $(ZLIB_PATH)/,	\
-					adler32.c	\
-					crc32.c		\
-					inffast.c	\
 					inflate.c	\
 					inftrees.c	\
 					zutil.c)
 
+ifeq (${ZLIB_AARCH64_OPT},1)
+ZLIB_SOURCES	+=	$(addprefix $(ZLIB_PATH)/aarch64/,	\
+					inffast_chunk.c	\
+					zlib_aarch64.c	\
+					zlib_aarch64.S)
+else
+ZLIB_SOURCES	+=	$(addprefix $(ZLIB_PATH)/,	\
+					adler32.c	\
+					crc32.c		\
+					inffast.c)
+endif
+
 # Implemented for TF
 ZLIB_SOURCES	+=	$(addprefix $(ZLIB_PATH)/,	\
 					tf_gunzip.c)
@@ -97,6 +97,9 @@ ENABLE_PSCI_STAT		:= 0
 # Flag to enable runtime instrumentation using PMF
 ENABLE_RUNTIME_INSTRUMENTATION	:= 0
 
+# Flag to enable boot time instrumentation of BL2 and BL31 using PMF
+BOOT_TIME_INSTRUMENTATION	:= 0
+
 # Flag to enable stack corruption protection
 ENABLE_STACK_PROTECTOR		:= 0
 
@@ -150,6 +153,10 @@ HANDLE_EA_EL3_FIRST_NS		:= 0
 # Enable Handoff protocol using transfer lists
 TRANSFER_LIST			:= 0
 
+# Put a tag index, which the Firmware Handoff specification does not define,
+# first in the transfer lists the platform creates
+TRANSFER_LIST_INDEX		:= 0
+
 # Secure hash algorithm flag, accepts 3 values: sha256, sha384 and sha512.
 # The default value is sha256.
 HASH_ALG			:= sha256
@@ -191,6 +198,9 @@ PSCI_EXTENDED_STATE_ID		:= 0
 # Enable PSCI OS-initiated mode support
 PSCI_OS_INIT_MODE		:= 0
 
+# Use ticket locks instead of bakery locks for PSCI power domain coordination
+PSCI_TICKET_LOCK		:= 0
+
 # Enable RAS Firmware First Handling Support
 RAS_FFH_SUPPORT			:= 0
 
@@ -206,6 +216,9 @@ SDEI_SUPPORT			:= 0
 # True Random Number firmware Interface support
 TRNG_SUPPORT			:= 0
 
+# Keep a lock-free TRNG entropy pool per CPU instead of a shared one
+TRNG_PER_CPU_POOL		:= 0
+
 # Check to see if Errata ABI is supported
 ERRATA_ABI_SUPPORT		:= 0
 
@@ -250,6 +263,10 @@ SPIN_ON_BL1_EXIT		:= 0
 # Flags to build TF with Trusted Boot support
 TRUSTED_BOARD_BOOT		:= 0
 
+# Size in bytes of the chunks an image is split into for the chunked image
+# hash. 0 hashes every image as a whole.
+TBB_HASH_CHUNK_SIZE		:= 0
+
 # Build option to choose whether Trusted Firmware uses Coherent memory or not.
 USE_COHERENT_MEM		:= 1
 
@@ -275,6 +292,10 @@ USE_ROMLIB			:= 0
 # level makefile where we can check for incompatible features/build options.
 ALLOW_RO_XLAT_TABLES		:= 0
 
+# Build option to merge adjacent MT_CONTIG memory regions with the same
+# attributes and to set the contiguous hint on aligned groups of descriptors.
+XLAT_TABLES_CONTIG		:= 0
+
 # Chain of trust.
 COT				:= tbbr
 
@@ -367,3 +388,10 @@ PSA_CRYPTO			:= 0
 # Disabled by default because it constitutes an attack vector into TF-A. It
 # should only be enabled if there is a use case for it.
 ENABLE_CONSOLE_GETC		:= 0
+
+# Messages at this log level and above (more verbose) are recorded in a binary
+# trace instead of being printed, 0 prints all of them.
+LOG_BINARY_LEVEL		:= 0
+
+# Number of messages kept per CPU in the binary trace.
+LOG_BINARY_RECORDS		:= 64
@@ -75,6 +75,8 @@ $(if ${KEY_SIZE},$(eval $(call CERT_ADD_CMD_OPT,${KEY_SIZE},--key-size)))
 $(if ${KEY_SIZE},$(eval $(call CERT_ADD_CMD_OPT,${KEY_SIZE},--key-size,FWU_)))
 $(if ${HASH_ALG},$(eval $(call CERT_ADD_CMD_OPT,${HASH_ALG},--hash-alg)))
 $(if ${HASH_ALG},$(eval $(call CERT_ADD_CMD_OPT,${HASH_ALG},--hash-alg,FWU_)))
+$(if $(filter-out 0,${TBB_HASH_CHUNK_SIZE}),$(eval $(call CERT_ADD_CMD_OPT,${TBB_HASH_CHUNK_SIZE},--hash-chunk-size)))
+$(if $(filter-out 0,${TBB_HASH_CHUNK_SIZE}),$(eval $(call CERT_ADD_CMD_OPT,${TBB_HASH_CHUNK_SIZE},--hash-chunk-size,FWU_)))
 $(if ${ROT_KEY},$(eval $(call CERT_ADD_CMD_OPT,${ROT_KEY},--rot-key)))
 $(if ${ROT_KEY},$(eval $(call CERT_ADD_CMD_OPT,${ROT_KEY},--rot-key,FWU_)))
 $(if ${PROT_KEY},$(eval $(call CERT_ADD_CMD_OPT,${PROT_KEY},--prot-key)))
@@ -459,4 +459,12 @@ defined(IMAGE_BL2) && MEASURED_BOOT
  */
 #define PLAT_DRTM_MMAP_ENTRIES			PLAT_ARM_MMAP_ENTRIES
 
+/*
+ * Number of nodes fconf can index when BL31 or SP_MIN reads the HW_CONFIG DTB,
+ * whose FVP flavours have about 60.
+ */
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+#define PLAT_FCONF_INDEX_NODES			U(128)
+#endif
+
 #endif /* PLATFORM_DEF_H */
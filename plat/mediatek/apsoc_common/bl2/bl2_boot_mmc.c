@@ -13,8 +13,18 @@
 #include <drivers/io/io_block.h>
 #include <drivers/mmc.h>
 #include <drivers/mmc/mtk-sd.h>
+#include <lib/boot_time.h>
 #include "bl2_plat_setup.h"
 
+static size_t mmc_read_range(int lba, uintptr_t buf, size_t size)
+{
+	size_t len = mmc_read_blocks(lba, buf, size);
+
+	boot_time_account_io(BOOT_PROFILE_IO_MMC, len);
+
+	return len;
+}
+
 static io_block_dev_spec_t mmc_dev_spec = {
 	.buffer = {
 		.offset = IO_BLOCK_BUF_OFFSET,
@@ -22,7 +32,7 @@ static io_block_dev_spec_t mmc_dev_spec = {
 	},
 
 	.ops = {
-		.read = mmc_read_blocks,
+		.read = mmc_read_range,
 	},
 
 	.block_size = MMC_BLOCK_SIZE,
@@ -10,6 +10,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_block.h>
 #include <drivers/nand.h>
+#include <lib/boot_time.h>
 #include "bl2_plat_setup.h"
 
 static io_block_spec_t nand_dev_fip_spec;
@@ -99,6 +100,8 @@ static size_t nand_read_range(int lba, uintptr_t buf, size_t size)
 		      off, ret, length_read);
 	}
 
+	boot_time_account_io(BOOT_PROFILE_IO_NAND, length_read);
+
 	return length_read;
 }
 
@@ -11,6 +11,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_block.h>
 #include <drivers/nand.h>
+#include <lib/boot_time.h>
 #include <nmbm/nmbm.h>
 #include "bl2_plat_setup.h"
 
@@ -52,7 +53,6 @@ static void nmbm_lower_log(void *arg, enum nmbm_log_category level,
 			   const char *fmt, va_list ap)
 {
 	int log_level;
-	const char *prefix_str;
 
 	switch (level) {
 	case NMBM_LOG_DEBUG:
@@ -72,14 +72,8 @@ static void nmbm_lower_log(void *arg, enum nmbm_log_category level,
 	if (log_level > LOG_LEVEL)
 		return;
 
-	prefix_str = plat_log_get_prefix(log_level);
-
-	while (*prefix_str != '\0') {
-		(void)putchar(*prefix_str);
-		prefix_str++;
-	}
-
-	vprintf(fmt, ap);
+	/* Recorded rather than printed at LOG_BINARY_LEVEL and above */
+	tf_vlog(log_level, fmt, ap);
 }
 
 static int nmbm_init(void)
@@ -127,6 +121,8 @@ static size_t nmbm_read(int lba, uintptr_t buf, size_t size)
 	nmbm_read_range(ni, (uint64_t)lba * nand_dev->page_size, size,
 			(void *)buf, NMBM_MODE_PLACE_OOB, &retlen);
 
+	boot_time_account_io(BOOT_PROFILE_IO_NAND, retlen);
+
 	return retlen;
 }
 
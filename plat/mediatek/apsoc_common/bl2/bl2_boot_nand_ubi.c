@@ -10,6 +10,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_ubi.h>
 #include <drivers/nand.h>
+#include <lib/boot_time.h>
 #include "bl2_plat_setup.h"
 
 #ifdef OVERRIDE_UBI_START_ADDR
@@ -53,6 +54,8 @@ static int nand_ubispl_read(uint32_t pnum, unsigned long offset,
 		return ret;
 	}
 
+	boot_time_account_io(BOOT_PROFILE_IO_NAND, len_read);
+
 	return 0;
 }
 
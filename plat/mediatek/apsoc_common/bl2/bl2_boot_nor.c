@@ -10,6 +10,7 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_block.h>
 #include <drivers/spi_nor.h>
+#include <lib/boot_time.h>
 #include "bl2_plat_setup.h"
 
 #define READ_CHKSZ	0x1000
@@ -28,6 +29,8 @@ static size_t nor_read_range(int lba, uintptr_t buf, size_t size)
 			return size - len_left;
 		}
 
+		boot_time_account_io(BOOT_PROFILE_IO_NOR, chksz);
+
 		buf += chksz;
 		lba += chksz;
 		len_left -= chksz;
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <common/debug.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_storage.h>
+#include <tools_share/firmware_image_package.h>
+#include "bl2_plat_setup.h"
+
+/*
+ * Certificate prefetch
+ *
+ * fiptool places the TBBR certificates next to each other, after the images.
+ * Instead of opening the FIP (which re-reads its header) and doing a small
+ * bounce-buffered read for every certificate, read the region holding all of
+ * them once into CERT_CACHE_BUF. The certificates can then be served by a
+ * memmap device.
+ */
+
+/* Largest ToC read to locate the certificates */
+#define CERT_CACHE_TOC_MAX_ENTRIES	32
+
+static int cert_cache_read_toc(uintptr_t handle, size_t fip_size,
+			       const io_uuid_spec_t *const uuids[],
+			       io_block_spec_t specs[], unsigned int count,
+			       size_t *start, size_t *end)
+{
+	const fip_toc_header_t *hdr = (const void *)CERT_CACHE_BUF_OFFSET;
+	const fip_toc_entry_t *entry = (const void *)(hdr + 1);
+	const uuid_t uuid_null = { {0} };
+	size_t toc_size, len;
+	unsigned int i, found = 0;
+	int ret;
+
+	toc_size = sizeof(*hdr) + CERT_CACHE_TOC_MAX_ENTRIES * sizeof(*entry);
+	if (toc_size > fip_size)
+		toc_size = fip_size;
+
+	ret = io_read(handle, CERT_CACHE_BUF_OFFSET, toc_size, &len);
+	if (ret)
+		return ret;
+
+	if (len < sizeof(*hdr) || hdr->name != TOC_HEADER_NAME ||
+	    hdr->serial_number == 0)
+		return -ENOENT;
+
+	*start = SIZE_MAX;
+	*end = 0;
+
+	for (; (uintptr_t)(entry + 1) <= CERT_CACHE_BUF_OFFSET + len; entry++) {
+		if (!memcmp(&entry->uuid, &uuid_null, sizeof(uuid_t)))
+			break;
+
+		for (i = 0; i < count; i++) {
+			if (memcmp(&entry->uuid, &uuids[i]->uuid,
+				   sizeof(uuid_t)))
+				continue;
+
+			if (entry->offset_address > fip_size ||
+			    entry->size > fip_size - entry->offset_address)
+				return -EINVAL;
+
+			specs[i].offset = entry->offset_address;
+			specs[i].length = entry->size;
+
+			if (entry->offset_address < *start)
+				*start = entry->offset_address;
+			if (entry->offset_address + entry->size > *end)
+				*end = entry->offset_address + entry->size;
+
+			found++;
+			break;
+		}
+	}
+
+	return found ? 0 : -ENOENT;
+}
+
+/*
+ * mtk_cert_cache_load - read all certificates of the FIP in a single I/O
+ *
+ * Looks up @uuids in the ToC of the FIP at @fip_spec on @dev_handle and reads
+ * the region spanning them into CERT_CACHE_BUF. On success, @specs holds the
+ * memory location of each certificate, or a zero length if it is not in the
+ * FIP.
+ */
+int mtk_cert_cache_load(uintptr_t dev_handle, uintptr_t fip_spec,
+			const io_uuid_spec_t *const uuids[],
+			io_block_spec_t specs[], unsigned int count)
+{
+	uintptr_t handle;
+	size_t fip_size, start, end, len;
+	unsigned int i;
+	int ret;
+
+	ret = io_open(dev_handle, fip_spec, &handle);
+	if (ret)
+		return ret;
+
+	ret = io_size(handle, &fip_size);
+	if (ret)
+		goto out;
+
+	memset(specs, 0, count * sizeof(*specs));
+
+	ret = cert_cache_read_toc(handle, fip_size, uuids, specs, count,
+				  &start, &end);
+	if (ret)
+		goto out;
+
+	if (end - start > CERT_CACHE_BUF_SIZE) {
+		VERBOSE("BL2: certificates span 0x%zx bytes, not cached\n",
+			end - start);
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	ret = io_seek(handle, IO_SEEK_SET, (signed long long)start);
+	if (ret)
+		goto out;
+
+	ret = io_read(handle, CERT_CACHE_BUF_OFFSET, end - start, &len);
+	if (ret)
+		goto out;
+
+	if (len != end - start) {
+		ret = -EIO;
+		goto out;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (specs[i].length)
+			specs[i].offset += CERT_CACHE_BUF_OFFSET - start;
+	}
+
+	VERBOSE("BL2: cached certificates 0x%zx - 0x%zx of FIP\n", start, end);
+
+out:
+	io_close(handle);
+
+	return ret;
+}
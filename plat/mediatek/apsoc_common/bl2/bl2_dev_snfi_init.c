@@ -8,6 +8,7 @@
 #include <inttypes.h>
 #include <common/debug.h>
 #include <drivers/nand.h>
+#include <lib/boot_time.h>
 #include <mtk-snand.h>
 #include <mtk-snand-atf.h>
 #include "bl2_plat_setup.h"
@@ -26,9 +27,21 @@ static int snfi_mtd_read_page(struct nand_device *nand, unsigned int page,
 			       uintptr_t buffer)
 {
 	uint64_t addr = (uint64_t)page * nand->page_size;
+	uint32_t retries = mtk_snand_get_read_retries(snf);
+	uint32_t corrected = mtk_snand_get_ecc_corrected(snf);
 	int ret;
 
 	ret = mtk_snand_read_page(snf, addr, (void *)buffer, NULL, false);
+
+	/*
+	 * A positive return value is only the worst sector's bitflip count,
+	 * the profile wants the total over the page
+	 */
+	boot_time_account_io_errors(BOOT_PROFILE_IO_NAND,
+				    mtk_snand_get_read_retries(snf) - retries,
+				    mtk_snand_get_ecc_corrected(snf) - corrected,
+				    ret == -EBADMSG);
+
 	if (ret == -EBADMSG)
 		ret = 0;
 
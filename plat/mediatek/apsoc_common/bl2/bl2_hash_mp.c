@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <string.h>
+#include <drivers/auth/crypto_mod.h>
+#include <plat/common/platform.h>
+#include <tools_share/tbb_hash_chunk.h>
+#include "bl2_mp.h"
+
+/* Number of chunks handed out per mtk_bl2_mp_run() call */
+#define HASH_MP_BATCH		16U
+
+struct hash_job_ctx {
+	void *data;
+	unsigned int len;
+	unsigned char *digest;
+};
+
+static struct hash_job_ctx hash_ctx[HASH_MP_BATCH];
+static struct mtk_bl2_mp_job hash_jobs[HASH_MP_BATCH];
+
+static int hash_chunk(void *arg)
+{
+	struct hash_job_ctx *ctx = arg;
+	unsigned char md[CRYPTO_MD_MAX_SIZE];
+	int rc;
+
+	rc = crypto_mod_calc_hash(CRYPTO_MD_SHA256, ctx->data, ctx->len, md);
+	if (rc)
+		return rc;
+
+	memcpy(ctx->digest, md, TBB_HASH_CHUNK_DIGEST_SIZE);
+
+	return 0;
+}
+
+/* Hash the chunks of an image on all cores */
+int plat_auth_hash_chunks(void *data_ptr, unsigned int data_len,
+			  unsigned int chunk_size, unsigned char *digests)
+{
+	unsigned char *p = data_ptr;
+	unsigned int i, len;
+	int rc;
+
+	/* Not worth waking the secondary cores for a single chunk */
+	if (data_len <= chunk_size) {
+		hash_ctx[0].data = p;
+		hash_ctx[0].len = data_len;
+		hash_ctx[0].digest = digests;
+
+		return hash_chunk(&hash_ctx[0]);
+	}
+
+	if (!mtk_bl2_mp_active())
+		mtk_bl2_mp_start();
+
+	while (data_len) {
+		for (i = 0; i < HASH_MP_BATCH && data_len; i++) {
+			len = data_len < chunk_size ? data_len : chunk_size;
+
+			hash_ctx[i].data = p;
+			hash_ctx[i].len = len;
+			hash_ctx[i].digest = digests;
+
+			hash_jobs[i].fn = hash_chunk;
+			hash_jobs[i].arg = &hash_ctx[i];
+
+			p += len;
+			data_len -= len;
+			digests += TBB_HASH_CHUNK_DIGEST_SIZE;
+		}
+
+		rc = mtk_bl2_mp_run(hash_jobs, i);
+		if (rc)
+			return rc;
+	}
+
+	return 0;
+}
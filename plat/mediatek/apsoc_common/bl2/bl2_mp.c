@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/delay_timer.h>
+#include <plat/common/platform.h>
+#include <platform_def.h>
+#include "bl2_mp.h"
+
+/*
+ * BL2 runs with the MMU and data cache disabled, so exclusive accesses are
+ * not usable for locking. Each secondary core owns one mailbox instead: the
+ * primary core only writes 'cmd', 'job' and 'seq', and the secondary only
+ * writes 'ack' and 'online'. A command is pending while seq != ack.
+ * 'released' is private to the primary core and records which secondaries
+ * were powered on, whether or not they reached the job loop in time.
+ */
+#define MP_CMD_RUN		1
+#define MP_CMD_EXIT		2
+
+struct mtk_bl2_mp_mbox {
+	volatile uint32_t cmd;
+	volatile uint32_t seq;
+	volatile uint32_t ack;
+	volatile uint32_t online;
+	struct mtk_bl2_mp_job *volatile job;
+	bool released;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct mtk_bl2_mp_mbox mp_mbox[PLATFORM_CORE_COUNT];
+static unsigned int mp_primary;
+static bool mp_started;
+
+/* Wait time for a secondary core to reach the job loop, in microseconds */
+#define MP_ONLINE_TIMEOUT_US	10000
+/* Wait time for a secondary core to acknowledge MP_CMD_EXIT */
+#define MP_STOP_TIMEOUT_US	10000
+
+static void mp_post(struct mtk_bl2_mp_mbox *mbox, uint32_t cmd,
+		    struct mtk_bl2_mp_job *job)
+{
+	mbox->cmd = cmd;
+	mbox->job = job;
+	dsbsy();
+	mbox->seq = mbox->seq + 1;
+	dsbsy();
+	sev();
+}
+
+static bool mp_idle(const struct mtk_bl2_mp_mbox *mbox)
+{
+	return mbox->ack == mbox->seq;
+}
+
+void mtk_bl2_mp_secondary_main(void)
+{
+	unsigned int cpu = plat_my_core_pos();
+	struct mtk_bl2_mp_mbox *mbox = &mp_mbox[cpu];
+	struct mtk_bl2_mp_job *job;
+	uint32_t seq;
+
+	mbox->online = 1;
+	dsbsy();
+	sev();
+
+	while (true) {
+		while (mbox->seq == mbox->ack)
+			wfe();
+
+		seq = mbox->seq;
+		dsbsy();
+
+		if (mbox->cmd == MP_CMD_EXIT)
+			break;
+
+		job = mbox->job;
+		job->ret = job->fn(job->arg);
+
+		dsbsy();
+		mbox->ack = seq;
+		dsbsy();
+		sev();
+	}
+
+	/* Arm the power-down of this core, then report it offline */
+	mtk_plat_bl2_cpu_off(cpu);
+
+	mbox->ack = seq;
+	mbox->online = 0;
+	dsbsy();
+	sev();
+
+	while (true)
+		wfi();
+}
+
+unsigned int mtk_bl2_mp_start(void)
+{
+	unsigned int cpu, online = 1;
+	uint64_t timeout;
+	int ret;
+
+	assert(!mp_started);
+
+	mp_primary = plat_my_core_pos();
+
+	for (cpu = 0; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		if (cpu == mp_primary)
+			continue;
+
+		mp_mbox[cpu].seq = 0;
+		mp_mbox[cpu].ack = 0;
+		mp_mbox[cpu].online = 0;
+		mp_mbox[cpu].released = false;
+		dsbsy();
+
+		ret = mtk_plat_bl2_cpu_on(cpu,
+					  (uintptr_t)mtk_bl2_mp_entrypoint);
+		if (ret) {
+			WARN("BL2: failed to release CPU%u (%d)\n", cpu, ret);
+			continue;
+		}
+
+		mp_mbox[cpu].released = true;
+	}
+
+	for (cpu = 0; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		if (cpu == mp_primary || !mp_mbox[cpu].released)
+			continue;
+
+		timeout = timeout_init_us(MP_ONLINE_TIMEOUT_US);
+		while (!mp_mbox[cpu].online && !timeout_elapsed(timeout))
+			;
+
+		if (mp_mbox[cpu].online)
+			online++;
+		else
+			WARN("BL2: CPU%u did not come online\n", cpu);
+	}
+
+	mp_started = true;
+
+	VERBOSE("BL2: %u CPUs online\n", online);
+
+	return online;
+}
+
+bool mtk_bl2_mp_active(void)
+{
+	return mp_started;
+}
+
+int mtk_bl2_mp_run(struct mtk_bl2_mp_job *jobs, unsigned int count)
+{
+	struct mtk_bl2_mp_mbox *mbox;
+	unsigned int next = 0, cpu, i;
+	bool busy;
+	int ret = 0;
+
+	while (next < count) {
+		/* Hand out jobs to every idle secondary core */
+		for (cpu = 0; cpu < PLATFORM_CORE_COUNT && next < count; cpu++) {
+			mbox = &mp_mbox[cpu];
+
+			if (!mp_started || cpu == mp_primary || !mbox->online ||
+			    !mp_idle(mbox))
+				continue;
+
+			mp_post(mbox, MP_CMD_RUN, &jobs[next++]);
+		}
+
+		/* Then take one for the primary core */
+		if (next < count) {
+			jobs[next].ret = jobs[next].fn(jobs[next].arg);
+			next++;
+		}
+	}
+
+	/* Join */
+	do {
+		busy = false;
+
+		for (cpu = 0; cpu < PLATFORM_CORE_COUNT; cpu++) {
+			if (cpu != mp_primary && !mp_idle(&mp_mbox[cpu]))
+				busy = true;
+		}
+
+		if (busy)
+			wfe();
+	} while (busy);
+
+	dsbsy();
+
+	for (i = 0; i < count; i++) {
+		if (jobs[i].ret && !ret)
+			ret = jobs[i].ret;
+	}
+
+	return ret;
+}
+
+void mtk_bl2_mp_stop(void)
+{
+	struct mtk_bl2_mp_mbox *mbox;
+	unsigned int cpu;
+	uint64_t timeout;
+
+	if (!mp_started)
+		return;
+
+	/*
+	 * Post the exit to every released core, including ones that missed the
+	 * online timeout: a late core finds the command pending as soon as it
+	 * enters the job loop and powers itself down straight away.
+	 */
+	for (cpu = 0; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		if (cpu == mp_primary || !mp_mbox[cpu].released)
+			continue;
+
+		mp_post(&mp_mbox[cpu], MP_CMD_EXIT, NULL);
+	}
+
+	for (cpu = 0; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		mbox = &mp_mbox[cpu];
+
+		if (cpu == mp_primary || !mbox->released)
+			continue;
+
+		timeout = timeout_init_us(MP_STOP_TIMEOUT_US);
+		while ((!mp_idle(mbox) || mbox->online) &&
+		       !timeout_elapsed(timeout))
+			;
+
+		if (!mp_idle(mbox) || mbox->online)
+			WARN("BL2: CPU%u did not stop\n", cpu);
+
+		mbox->released = false;
+	}
+
+	mp_started = false;
+}
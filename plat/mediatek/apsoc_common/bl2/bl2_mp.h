@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BL2_MP_H
+#define BL2_MP_H
+
+/* Per-CPU stack used by secondary cores while they run BL2 jobs */
+#define MTK_BL2_MP_STACK_SIZE		0x1000
+
+#ifndef __ASSEMBLER__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct mtk_bl2_mp_job {
+	int (*fn)(void *arg);
+	void *arg;
+	int ret;
+};
+
+/*
+ * Release all secondary cores into the BL2 job loop. Returns the number of
+ * cores (including the calling one) available for mtk_bl2_mp_run().
+ */
+unsigned int mtk_bl2_mp_start(void);
+
+/*
+ * Run @count jobs on all online cores, the calling core included, and wait
+ * until every job has finished. Returns 0 if all jobs returned 0, otherwise
+ * the first non-zero job return value.
+ */
+int mtk_bl2_mp_run(struct mtk_bl2_mp_job *jobs, unsigned int count);
+
+/* Power secondary cores off again. Must be called before BL31 handoff. */
+void mtk_bl2_mp_stop(void);
+
+bool mtk_bl2_mp_active(void);
+
+/* C entry for secondary cores, called by mtk_bl2_mp_entrypoint */
+void mtk_bl2_mp_secondary_main(void);
+void mtk_bl2_mp_entrypoint(void);
+
+/* The following functions are provided by platform */
+int mtk_plat_bl2_cpu_on(unsigned int cpu, uintptr_t entrypoint);
+void mtk_plat_bl2_cpu_off(unsigned int cpu);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* BL2_MP_H */
@@ -13,11 +13,20 @@
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_fip.h>
 #include <drivers/io/io_fat.h>
+#include <drivers/io/io_memmap.h>
+#include <drivers/ring_console.h>
+#include <lib/boot_time.h>
 #include <tools_share/firmware_image_package.h>
 #include <hsuart.h>
 #include <platform_def.h>
 #include <plat_private.h>
 #include "bl2_plat_setup.h"
+#ifdef MTK_BL33_XZ_DECOMP
+#include "bl2_xz_mp.h"
+#endif
+#ifdef MTK_BL2_MP
+#include "bl2_mp.h"
+#endif
 #include "../bl31/bl31_common_setup.h"
 
 struct plat_io_policy {
@@ -45,6 +54,10 @@ static bl_mem_params_node_t bl2_mem_params_descs[] = {
 		.ep_info.pc = BL31_BASE,
 		.ep_info.spsr = SPSR_64(MODE_EL3, MODE_SP_ELX,
 					DISABLE_ALL_EXCEPTIONS),
+#if BOOT_TIME_INSTRUMENTATION
+		.ep_info.args.arg2 = sizeof(struct boot_time_handoff),
+		.ep_info.args.arg3 = (uintptr_t)&boot_time_handoff,
+#endif
 
 		SET_STATIC_PARAM_HEAD(image_info, PARAM_EP, VERSION_2,
 				      image_info_t, IMAGE_ATTRIB_PLAT_SETUP),
@@ -288,6 +301,79 @@ static struct plat_io_policy policies[] = {
 #endif /* TRUSTED_BOARD_BOOT */
 };
 
+#if TRUSTED_BOARD_BOOT
+static const io_dev_connector_t *cert_cache_dev_con;
+static uintptr_t cert_cache_dev_handle;
+
+static const unsigned int cert_cache_ids[] = {
+	TRUSTED_KEY_CERT_ID,
+	SCP_FW_KEY_CERT_ID,
+	SOC_FW_KEY_CERT_ID,
+	TRUSTED_OS_FW_KEY_CERT_ID,
+	NON_TRUSTED_FW_KEY_CERT_ID,
+	SCP_FW_CONTENT_CERT_ID,
+	SOC_FW_CONTENT_CERT_ID,
+	TRUSTED_OS_FW_CONTENT_CERT_ID,
+	NON_TRUSTED_FW_CONTENT_CERT_ID,
+};
+
+static io_block_spec_t cert_cache_specs[ARRAY_SIZE(cert_cache_ids)];
+
+static int check_cert_cache(const uintptr_t spec)
+{
+	return 0;
+}
+
+/*
+ * Read all certificates in one go and serve them from memory, so that loading
+ * each of them no longer needs a FIP lookup and a flash read of its own.
+ * Certificates which could not be cached are still loaded from the FIP.
+ */
+static void bl2_cert_cache_setup(void)
+{
+	const io_uuid_spec_t *uuids[ARRAY_SIZE(cert_cache_ids)];
+	struct plat_io_policy *policy;
+	unsigned int i;
+	int ret;
+
+	if (!mtk_boot_found_fip())
+		return;
+
+	for (i = 0; i < ARRAY_SIZE(cert_cache_ids); i++)
+		uuids[i] = (const void *)policies[cert_cache_ids[i]].image_spec;
+
+	ret = check_boot_dev(policies[FIP_IMAGE_ID].image_spec);
+	if (!ret)
+		ret = mtk_cert_cache_load(boot_dev_handle,
+					  policies[FIP_IMAGE_ID].image_spec,
+					  uuids, cert_cache_specs,
+					  ARRAY_SIZE(cert_cache_ids));
+	if (ret) {
+		VERBOSE("BL2: certificate prefetch skipped (%d)\n", ret);
+		return;
+	}
+
+	ret = register_io_dev_memmap(&cert_cache_dev_con);
+	if (!ret)
+		ret = io_dev_open(cert_cache_dev_con, (uintptr_t)NULL,
+				  &cert_cache_dev_handle);
+	if (ret) {
+		WARN("BL2: failed to open certificate cache (%d)\n", ret);
+		return;
+	}
+
+	for (i = 0; i < ARRAY_SIZE(cert_cache_ids); i++) {
+		if (!cert_cache_specs[i].length)
+			continue;
+
+		policy = &policies[cert_cache_ids[i]];
+		policy->dev_handle = &cert_cache_dev_handle;
+		policy->image_spec = (uintptr_t)&cert_cache_specs[i];
+		policy->check = check_cert_cache;
+	}
+}
+#endif /* TRUSTED_BOARD_BOOT */
+
 int plat_get_image_source(unsigned int image_id, uintptr_t *dev_handle,
 			  uintptr_t *image_spec)
 {
@@ -323,13 +409,64 @@ void platform_mem_init(void)
 {
 }
 
+#ifdef MTK_BL33_XZ_DECOMP
+int bl2_plat_handle_pre_image_load(unsigned int image_id)
+{
+	bl_mem_params_node_t *desc;
+
+	if (image_id != BL33_IMAGE_ID)
+		return 0;
+
+	desc = get_bl_mem_params_node(image_id);
+	assert(desc != NULL);
+
+	image_decompress_prepare(&desc->image_info);
+
+	return 0;
+}
+
+int bl2_plat_handle_post_image_load(unsigned int image_id)
+{
+	bl_mem_params_node_t *desc;
+	int ret;
+
+	if (image_id != BL33_IMAGE_ID)
+		return 0;
+
+	desc = get_bl_mem_params_node(image_id);
+	assert(desc != NULL);
+
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_DECOMP_START);
+	ret = image_decompress(&desc->image_info);
+	boot_time_capture_img(image_id, BOOT_TIME_IMG_DECOMP_END);
+
+	return ret;
+}
+#endif
+
+#ifdef MTK_BL2_MP
+void bl2_el3_plat_prepare_exit(void)
+{
+	/* Secondary cores must be parked before BL31 takes over */
+	mtk_bl2_mp_stop();
+}
+#endif
+
 void bl2_el3_early_platform_setup(u_register_t arg0, u_register_t arg1,
 				  u_register_t arg2, u_register_t arg3)
 {
 	static console_t console;
+#ifdef MTK_CONSOLE_RING
+	static char console_ring[MTK_CONSOLE_RING_SIZE] __aligned(8);
+#endif
 
 	console_hsuart_register(UART_BASE, UART_CLOCK, UART_BAUDRATE,
 			        true, &console);
+
+#ifdef MTK_CONSOLE_RING
+	console_ring_register((uintptr_t)console_ring, sizeof(console_ring),
+			      &console, console_hsuart_tx_ready);
+#endif
 }
 
 static void bl2_run_initcalls(void)
@@ -347,8 +484,10 @@ static int bl2_fip_boot_setup(void)
 	int ret;
 
 #ifdef MTK_MMC_BOOT
+	BOOT_TIME_CAPTURE(BOOT_TIME_GPT_PARSE_START);
 	ret = mtk_mmc_gpt_image_setup(&gpt_dev_handle,
 				      &policies[GPT_IMAGE_ID].image_spec);
+	BOOT_TIME_CAPTURE(BOOT_TIME_GPT_PARSE_END);
 	if (ret)
 		return ret;
 #endif
@@ -378,11 +517,24 @@ void bl2_platform_setup(void)
 {
 	int ret;
 
+	/* Storage drivers are brought up by the initcalls */
+	BOOT_TIME_CAPTURE(BOOT_TIME_STORAGE_INIT_START);
+
 	bl2_run_initcalls();
 
 	ret = bl2_fip_boot_setup();
+	BOOT_TIME_CAPTURE(BOOT_TIME_STORAGE_INIT_END);
 	if (ret) {
 		ERROR("FIP boot source initialization failed with %d\n", ret);
 		panic();
 	}
+
+#if TRUSTED_BOARD_BOOT
+	bl2_cert_cache_setup();
+#endif
+
+#ifdef MTK_BL33_XZ_DECOMP
+	image_decompress_init(FIP_DECOMP_BUF_OFFSET, FIP_DECOMP_BUF_SIZE,
+			      mtk_unxz_mp);
+#endif
 }
@@ -9,6 +9,7 @@
 
 #include <stddef.h>
 #include <stdint.h>
+#include <drivers/io/io_storage.h>
 
 /* BL2 initcalls */
 struct initcall {
@@ -31,6 +32,10 @@ extern const struct initcall bl2_initcalls[];
 #define FIP_DECOMP_BUF_OFFSET		0x40800000
 #define FIP_DECOMP_BUF_SIZE		0x400000
 
+/* TBBR certificate cache */
+#define CERT_CACHE_BUF_OFFSET		0x40200000
+#define CERT_CACHE_BUF_SIZE		0x10000
+
 /* Block read buffer */
 #define IO_BLOCK_BUF_OFFSET		0x41000000
 #define IO_BLOCK_BUF_SIZE		0xe00000
@@ -39,6 +44,9 @@ int mtk_mmc_gpt_image_setup(uintptr_t *dev_handle, uintptr_t *image_spec);
 int mtk_fip_image_setup(uintptr_t *dev_handle, uintptr_t *image_spec);
 void mtk_fip_location(size_t *fip_off, size_t *fip_size);
 bool mtk_boot_found_fip();
+int mtk_cert_cache_load(uintptr_t dev_handle, uintptr_t fip_spec,
+			const io_uuid_spec_t *const uuids[],
+			io_block_spec_t specs[], unsigned int count);
 
 /* The following function prototypes are provided by platfrom's boot device */
 int mtk_plat_nor_setup(void);
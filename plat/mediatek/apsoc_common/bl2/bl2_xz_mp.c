@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/utils.h>
+#include <tf_unxz.h>
+#include <plat/common/platform.h>
+#include <platform_def.h>
+#ifdef MTK_BL2_MP
+#include "bl2_mp.h"
+#endif
+#include "bl2_xz_mp.h"
+
+/*
+ * Chunked XZ container, generated by tools/mediatek/xzchunk:
+ *
+ *   struct mtk_xzc_hdr
+ *   struct mtk_xzc_chunk[num_chunks]
+ *   XZ streams
+ *
+ * Each chunk is an independent XZ stream, so chunks can be decompressed on
+ * different CPUs at the same time. All offsets are little-endian. Chunk
+ * offsets are relative to the start of the container, output offsets are
+ * relative to the start of the image, and the output of all chunks must be
+ * contiguous.
+ *
+ * A chunk which XZ doesn't shrink is stored raw, with its size equal to its
+ * output size, and copied. It may start like an XZ stream, so it must not be
+ * given to unxz(). XZ chunks are always smaller than their output.
+ */
+#define MTK_XZC_MAGIC		0x435a584d	/* "MXZC" */
+#define MTK_XZC_MAX_CHUNKS	64
+
+struct mtk_xzc_hdr {
+	uint32_t magic;
+	uint32_t num_chunks;
+	uint32_t hdr_size;
+	uint32_t reserved;
+};
+
+struct mtk_xzc_chunk {
+	uint32_t offset;
+	uint32_t size;
+	uint32_t out_offset;
+	uint32_t out_size;
+};
+
+struct xzc_job_ctx {
+	uintptr_t in;
+	size_t in_len;
+	uintptr_t out;
+	size_t out_len;
+	uintptr_t work;
+	size_t work_per_cpu;
+};
+
+static struct xzc_job_ctx xzc_ctx[MTK_XZC_MAX_CHUNKS];
+
+#ifdef MTK_BL2_MP
+static struct mtk_bl2_mp_job xzc_jobs[MTK_XZC_MAX_CHUNKS];
+
+#define XZC_WORK_SLICES		PLATFORM_CORE_COUNT
+#define xzc_work_slice()	plat_my_core_pos()
+#else
+#define XZC_WORK_SLICES		1
+#define xzc_work_slice()	0
+#endif
+
+static int xzc_decompress_chunk(void *arg)
+{
+	struct xzc_job_ctx *ctx = arg;
+	uintptr_t in = ctx->in, out = ctx->out;
+	uintptr_t work;
+	int ret;
+
+	if (ctx->in_len == ctx->out_len) {
+		memcpy((void *)out, (const void *)in, ctx->out_len);
+		return 0;
+	}
+
+	/* Every CPU uses its own slice of the workspace */
+	work = ctx->work + xzc_work_slice() * ctx->work_per_cpu;
+
+	ret = unxz(&in, ctx->in_len, &out, ctx->out_len, work,
+		   ctx->work_per_cpu);
+	if (ret)
+		return ret;
+
+	if (out - ctx->out != ctx->out_len)
+		return -EIO;
+
+	return 0;
+}
+
+static int xzc_parse(uintptr_t base, size_t len, size_t out_len,
+		     const struct mtk_xzc_chunk **chunks, uint32_t *count)
+{
+	const struct mtk_xzc_hdr *hdr = (const void *)base;
+	const struct mtk_xzc_chunk *c;
+	uint32_t i, next_out = 0;
+
+	if (len < sizeof(*hdr) || hdr->magic != MTK_XZC_MAGIC)
+		return -ENOENT;
+
+	if (!hdr->num_chunks || hdr->num_chunks > MTK_XZC_MAX_CHUNKS) {
+		ERROR("XZC: invalid number of chunks %u\n", hdr->num_chunks);
+		return -EINVAL;
+	}
+
+	if (hdr->hdr_size < sizeof(*hdr) + hdr->num_chunks * sizeof(*c) ||
+	    hdr->hdr_size > len) {
+		ERROR("XZC: invalid header size %u\n", hdr->hdr_size);
+		return -EINVAL;
+	}
+
+	c = (const void *)(base + sizeof(*hdr));
+
+	for (i = 0; i < hdr->num_chunks; i++) {
+		if (c[i].offset < hdr->hdr_size || c[i].offset > len ||
+		    c[i].size > len - c[i].offset ||
+		    c[i].out_offset != next_out ||
+		    c[i].out_size > out_len - next_out ||
+		    c[i].size > c[i].out_size) {
+			ERROR("XZC: invalid chunk %u\n", i);
+			return -EINVAL;
+		}
+
+		next_out += c[i].out_size;
+	}
+
+	*chunks = c;
+	*count = hdr->num_chunks;
+
+	return 0;
+}
+
+/*
+ * mtk_unxz_mp - decompress a chunked XZ image on all available CPUs
+ *
+ * Same interface as unxz(). Images without the container header are passed
+ * to unxz() unchanged.
+ */
+int mtk_unxz_mp(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+		size_t out_len, uintptr_t work_buf, size_t work_len)
+{
+	const struct mtk_xzc_chunk *chunks;
+	size_t work_per_cpu, total = 0;
+	uint32_t i, count;
+	int ret;
+
+	ret = xzc_parse(*in_buf, in_len, out_len, &chunks, &count);
+	if (ret == -ENOENT)
+		return unxz(in_buf, in_len, out_buf, out_len, work_buf,
+			    work_len);
+	if (ret)
+		return ret;
+
+	if (work_len < CACHE_WRITEBACK_GRANULE * (XZC_WORK_SLICES + 1))
+		return -ENOMEM;
+
+	/* The CRC tables are shared, build them before going parallel */
+	unxz_init();
+
+	work_buf = round_up(work_buf, CACHE_WRITEBACK_GRANULE);
+	work_per_cpu = round_down(work_len - CACHE_WRITEBACK_GRANULE,
+				  CACHE_WRITEBACK_GRANULE) / XZC_WORK_SLICES;
+
+	for (i = 0; i < count; i++) {
+		xzc_ctx[i].in = *in_buf + chunks[i].offset;
+		xzc_ctx[i].in_len = chunks[i].size;
+		xzc_ctx[i].out = *out_buf + chunks[i].out_offset;
+		xzc_ctx[i].out_len = chunks[i].out_size;
+		xzc_ctx[i].work = work_buf;
+		xzc_ctx[i].work_per_cpu = work_per_cpu;
+		total += chunks[i].out_size;
+	}
+
+#ifdef MTK_BL2_MP
+	if (!mtk_bl2_mp_active())
+		mtk_bl2_mp_start();
+
+	for (i = 0; i < count; i++) {
+		xzc_jobs[i].fn = xzc_decompress_chunk;
+		xzc_jobs[i].arg = &xzc_ctx[i];
+	}
+
+	ret = mtk_bl2_mp_run(xzc_jobs, count);
+#else
+	for (i = 0; i < count; i++) {
+		ret = xzc_decompress_chunk(&xzc_ctx[i]);
+		if (ret)
+			break;
+	}
+#endif
+
+	if (ret) {
+		ERROR("XZC: decompression failed (%d)\n", ret);
+		return ret;
+	}
+
+	VERBOSE("XZC: %u chunks, %zu bytes\n", count, total);
+
+	*in_buf += in_len;
+	*out_buf += total;
+
+	return 0;
+}
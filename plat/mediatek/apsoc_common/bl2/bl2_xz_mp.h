@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BL2_XZ_MP_H
+#define BL2_XZ_MP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+int mtk_unxz_mp(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+		size_t out_len, uintptr_t work_buf, size_t work_len);
+
+#endif /* BL2_XZ_MP_H */
@@ -0,0 +1,16 @@
+#
+# Copyright (c) 2026, MediaTek Inc. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Decompress BL33 in BL2. Both plain XZ images and chunked XZ containers
+# generated by tools/mediatek/xzchunk are accepted.
+BL33_XZ_DECOMP		?=	0
+
+$(eval $(call assert_boolean,BL33_XZ_DECOMP))
+
+ifeq ($(BL33_XZ_DECOMP),1)
+BL2_SOURCES		+=	$(APSOC_COMMON)/bl2/bl2_xz_mp.c
+BL2_CPPFLAGS		+=	-DMTK_BL33_XZ_DECOMP
+endif # END OF BL33_XZ_DECOMP
@@ -0,0 +1,25 @@
+#
+# Copyright (c) 2026, MediaTek Inc. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Use the secondary cores in BL2 to decompress the chunks of a chunked XZ
+# container and to hash the chunks of images with TBB_HASH_CHUNK_SIZE set
+BL2_MP			?=	0
+
+$(eval $(call assert_boolean,BL2_MP))
+
+ifeq ($(BL2_MP),1)
+BL2_SOURCES		+=	$(APSOC_COMMON)/bl2/bl2_mp.c			\
+				$(APSOC_COMMON)/bl2/bl2_mp_entry.S		\
+				$(MTK_PLAT_SOC)/drivers/spmc/mtspmc.c
+BL2_CPPFLAGS		+=	-I$(MTK_PLAT_SOC)/drivers/spmc			\
+				-DMTK_BL2_MP -DXZ_MULTI_CPU
+
+ifeq ($(TRUSTED_BOARD_BOOT),1)
+ifneq ($(TBB_HASH_CHUNK_SIZE),0)
+BL2_SOURCES		+=	$(APSOC_COMMON)/bl2/bl2_hash_mp.c
+endif
+endif # END OF TRUSTED_BOARD_BOOT
+endif # END OF BL2_MP
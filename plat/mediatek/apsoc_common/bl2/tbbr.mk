@@ -9,6 +9,9 @@
 #
 ifeq ($(TRUSTED_BOARD_BOOT),1)
 
+# Use the SHA-2 instructions when the cores implement them
+MBEDTLS_SHA2_CE		?=	1
+
 include drivers/auth/mbedtls/mbedtls_crypto.mk
 include drivers/auth/mbedtls/mbedtls_x509.mk
 
@@ -25,6 +28,8 @@ AUTH_SOURCES		:=	drivers/auth/auth_mod.c				\
 				drivers/auth/tbbr/tbbr_cot_common.c
 
 BL2_SOURCES		+=	$(AUTH_SOURCES)					\
+				drivers/io/io_memmap.c				\
+				$(APSOC_COMMON)/bl2/bl2_cert_cache.c		\
 				$(APSOC_COMMON)/bl2/mtk_tbbr.c			\
 				$(APSOC_COMMON)/bl2/mtk_rotpk.S
 
@@ -7,6 +7,11 @@
 #include <arch/aarch64/arch.h>
 #include <arch/aarch64/arch_helpers.h>
 #include <common/runtime_svc.h>
+#ifdef MTK_EFUSE_SHM_ENABLE
+#include <string.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include "mtk_ns_map.h"
+#endif
 #include "mtk_boot_next.h"
 #include "mtk_sip_svc.h"
 #include "apsoc_sip_svc_common.h"
@@ -26,6 +31,9 @@ static uintptr_t apsoc_sip_boot_to_kernel(uint32_t smc_fid, u_register_t x1,
 }
 #endif
 
+/* Data buffer shared by the SEND_DATA/GET_DATA and READ/WRITE calls */
+static uint32_t efuse_buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
+
 static uintptr_t apsoc_sip_efuse_get_len(uint32_t smc_fid, u_register_t x1,
 					 u_register_t x2, u_register_t x3,
 					 u_register_t x4, void *cookie,
@@ -43,7 +51,6 @@ static uintptr_t apsoc_sip_efuse_send_data(uint32_t smc_fid, u_register_t x1,
 					   u_register_t x4, void *cookie,
 					   void *handle, u_register_t flags)
 {
-	static uint32_t efuse_buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
 	uint32_t efuse_data[2] = { (uint32_t)x3, (uint32_t)x4 };
 	uintptr_t ret;
 
@@ -59,7 +66,6 @@ static uintptr_t apsoc_sip_efuse_get_data(uint32_t smc_fid, u_register_t x1,
 					  u_register_t x4, void *cookie,
 					  void *handle, u_register_t flags)
 {
-	static uint32_t efuse_buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
 	uint32_t efuse_data[2] = { (uint32_t)x3, (uint32_t)x4 };
 	uintptr_t ret;
 
@@ -75,7 +81,6 @@ static uintptr_t apsoc_sip_efuse_read(uint32_t smc_fid, u_register_t x1,
 				      u_register_t x4, void *cookie,
 				      void *handle, u_register_t flags)
 {
-	static uint32_t efuse_buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
 	uintptr_t ret;
 
 	ret = mtk_efuse_read((uint32_t)x1,
@@ -89,7 +94,6 @@ static uintptr_t apsoc_sip_efuse_write(uint32_t smc_fid, u_register_t x1,
 				       u_register_t x4, void *cookie,
 				       void *handle, u_register_t flags)
 {
-	static uint32_t efuse_buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
 	uintptr_t ret;
 
 	ret = mtk_efuse_write((uint32_t)x1,
@@ -109,6 +113,71 @@ static uintptr_t apsoc_sip_efuse_disable(uint32_t smc_fid, u_register_t x1,
 	SMC_RET4(handle, ret, 0x0, 0x0, 0x0);
 }
 
+#ifdef MTK_EFUSE_SHM_ENABLE
+static uintptr_t apsoc_sip_efuse_read_shm(uint32_t smc_fid, u_register_t x1,
+					  u_register_t x2, u_register_t x3,
+					  u_register_t x4, void *cookie,
+					  void *handle, u_register_t flags)
+{
+	uint32_t buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX];
+	uint32_t efuse_len = 0;
+	uintptr_t va;
+	uintptr_t ret;
+
+	ret = mtk_efuse_get_len((uint32_t)x1, &efuse_len);
+	if (ret != MTK_EFUSE_SUCCESS)
+		SMC_RET2(handle, ret, 0x0);
+
+	if (efuse_len > x3 || efuse_len > sizeof(buffer))
+		SMC_RET2(handle, MTK_EFUSE_ERROR_EFUSE_LEN_EXCEED_BUFFER_LEN,
+			 0x0);
+
+	ret = mtk_efuse_read((uint32_t)x1, (uint8_t *)buffer, sizeof(buffer));
+	if (ret != MTK_EFUSE_SUCCESS)
+		SMC_RET2(handle, ret, 0x0);
+
+	if (mtk_ns_map(x2, efuse_len, MT_RW, &va)) {
+		ret = MTK_EFUSE_ERROR_INVALIDE_SHM_BUFFER;
+	} else {
+		memcpy((void *)va, buffer, efuse_len);
+		(void)mtk_ns_unmap(va, efuse_len);
+	}
+
+	memset(buffer, 0x0, sizeof(buffer));
+
+	SMC_RET2(handle, ret, ret ? 0x0 : efuse_len);
+}
+
+static uintptr_t apsoc_sip_efuse_write_shm(uint32_t smc_fid, u_register_t x1,
+					   u_register_t x2, u_register_t x3,
+					   u_register_t x4, void *cookie,
+					   void *handle, u_register_t flags)
+{
+	uint32_t buffer[MTK_EFUSE_PUBK_HASH_INDEX_MAX] = { 0 };
+	uint32_t efuse_len = 0;
+	uintptr_t va;
+	uintptr_t ret;
+
+	ret = mtk_efuse_get_len((uint32_t)x1, &efuse_len);
+	if (ret != MTK_EFUSE_SUCCESS)
+		SMC_RET2(handle, ret, 0x0);
+
+	if (efuse_len > x3 || efuse_len > sizeof(buffer))
+		SMC_RET2(handle, MTK_EFUSE_ERROR_EFUSE_LEN_EXCEED_BUFFER_LEN,
+			 0x0);
+
+	if (mtk_ns_map(x2, efuse_len, MT_RO, &va))
+		SMC_RET2(handle, MTK_EFUSE_ERROR_INVALIDE_SHM_BUFFER, 0x0);
+
+	memcpy(buffer, (void *)va, efuse_len);
+	(void)mtk_ns_unmap(va, efuse_len);
+
+	/* mtk_efuse_write() clears the buffer */
+	ret = mtk_efuse_write((uint32_t)x1, (uint8_t *)buffer, sizeof(buffer));
+	SMC_RET2(handle, ret, ret ? 0x0 : efuse_len);
+}
+#endif /* MTK_EFUSE_SHM_ENABLE */
+
 #ifdef MTK_FSEK
 static uintptr_t apsoc_sip_fsek_get_shm_config(uint32_t smc_fid,
 					       u_register_t x1,
@@ -190,6 +259,10 @@ struct mtk_sip_call_record apsoc_common_sip_calls[] = {
 	MTK_SIP_CALL_RECORD(MTK_SIP_EFUSE_READ, apsoc_sip_efuse_read),
 	MTK_SIP_CALL_RECORD(MTK_SIP_EFUSE_WRITE, apsoc_sip_efuse_write),
 	MTK_SIP_CALL_RECORD(MTK_SIP_EFUSE_DISABLE, apsoc_sip_efuse_disable),
+#ifdef MTK_EFUSE_SHM_ENABLE
+	MTK_SIP_CALL_RECORD(MTK_SIP_EFUSE_READ_SHM, apsoc_sip_efuse_read_shm),
+	MTK_SIP_CALL_RECORD(MTK_SIP_EFUSE_WRITE_SHM, apsoc_sip_efuse_write_shm),
+#endif
 #ifdef MTK_FSEK
 	MTK_SIP_CALL_RECORD(MTK_SIP_FSEK_GET_SHM_CONFIG, apsoc_sip_fsek_get_shm_config),
 	MTK_SIP_CALL_RECORD(MTK_SIP_FSEK_DECRYPT_RFSK, apsoc_sip_fsek_decrypt_rfsk),
@@ -99,6 +99,34 @@ struct mtk_sip_call_record;
  */
 #define MTK_SIP_EFUSE_DISABLE			0xC2000506
 
+/*
+ *  MTK_SIP_EFUSE_READ_SHM - read efuse field into a non-secure buffer
+ *
+ *  parameters
+ *  @x1:	efuse field
+ *  @x2:	physical address of the non-secure buffer
+ *  @x3:	buffer length, at least the efuse field length
+ *
+ *  return
+ *  @r0:	status
+ *  @r1:	data length
+ */
+#define MTK_SIP_EFUSE_READ_SHM			0xC2000507
+
+/*
+ *  MTK_SIP_EFUSE_WRITE_SHM - write efuse field from a non-secure buffer
+ *
+ *  parameters
+ *  @x1:	efuse field
+ *  @x2:	physical address of the non-secure buffer
+ *  @x3:	buffer length, at least the efuse field length
+ *
+ *  return
+ *  @r0:	status
+ *  @r1:	data length
+ */
+#define MTK_SIP_EFUSE_WRITE_SHM			0xC2000508
+
 /*
  * MTK_SIP_FSEK_GET_SHM_CONFIG
  *
@@ -7,6 +7,12 @@
 #include <stddef.h>
 #include <platform_def.h>
 #include <hsuart.h>
+#include <drivers/ring_console.h>
+#include <lib/boot_time.h>
+
+#include "bl31_common_setup.h"
+
+static console_t console;
 
 /*******************************************************************************
  * Perform any BL3-1 early platform setup. Here is an opportunity to copy
@@ -19,8 +25,21 @@
 void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 				u_register_t arg2, u_register_t arg3)
 {
-	static console_t console;
-
 	console_hsuart_register(UART_BASE, UART_CLOCK, UART_BAUDRATE, true,
 				&console);
+
+	/* BL2 passes its boot time table in arg3, its size in arg2 */
+	boot_time_import(arg3, arg2);
+}
+
+#ifdef MTK_CONSOLE_RING
+/*
+ * The CPUs share the UART behind the rings through a spinlock, which needs the
+ * data cache on, so the UART is used directly until the MMU is enabled.
+ */
+void mtk_console_ring_setup(void)
+{
+	console_ring_register(MTK_CONSOLE_RING_BASE, MTK_CONSOLE_RING_SIZE,
+			      &console, console_hsuart_tx_ready);
 }
+#endif
@@ -11,4 +11,9 @@
 #define BL33_DTB_OFFSET     0x0AD00000
 #define BL33_END_OFFSET     0x0B000000
 
+#ifdef MTK_CONSOLE_RING
+/* Called by bl31_plat_arch_setup() once the MMU is enabled */
+void mtk_console_ring_setup(void);
+#endif
+
 #endif /* BL31_PLAT_SETUP_H */
@@ -4,15 +4,23 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <errno.h>
 #include <stdint.h>
+#include <stdio.h>
 #include <inttypes.h>
+#include <libfdt.h>
 #include <arch_helpers.h>
 #include <common/debug.h>
 #include <common/bl_common.h>
+#include <common/fdt_fixup.h>
+#include <lib/boot_time.h>
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/transfer_list.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
 #include <drivers/console.h>
 #include <platform_def.h>
 #include "mtk_boot_next.h"
+#include "mtk_ns_map.h"
 #include "bl31_common_setup.h"
 
 static entry_point_info_t bl32_ep_info;
@@ -48,8 +56,228 @@ static uint32_t mtk_default_spsr_for_bl33_entry(bool kernel, bool aarch64)
 	return spsr;
 }
 
+#ifdef MTK_BOOT_PROFILE_ENABLE
+/*
+ * Build a transfer list holding the boot profile for the kernel. Returns its
+ * address, or 0 if it could not be created.
+ */
+static uintptr_t mtk_boot_profile_tl(void)
+{
+	struct transfer_list_header *tl;
+	struct transfer_list_entry *te;
+
+	tl = transfer_list_init((void *)MTK_BOOT_PROFILE_BASE,
+				MTK_BOOT_PROFILE_SIZE);
+	if (!tl)
+		return 0;
+
+	te = transfer_list_add(tl, TL_TAG_BOOT_PROFILE,
+			       boot_time_profile_size(), NULL);
+	if (!te) {
+		WARN("Boot profile does not fit in 0x%x bytes\n",
+		     MTK_BOOT_PROFILE_SIZE);
+		return 0;
+	}
+
+	boot_time_fill_profile(transfer_list_entry_data(te));
+	transfer_list_update_checksum(tl);
+
+	/* The kernel starts with its caches off */
+	flush_dcache_range((uintptr_t)tl, tl->size);
+
+	return (uintptr_t)tl;
+}
+
+/* The arm64 boot protocol limit */
+#define MTK_KERNEL_DTB_MAX_SIZE	(0x200000)
+
+/* The arm64 Image header: image_size at 16, magic at 56 */
+#define MTK_ARM64_IMAGE_HDR_SIZE	(64)
+#define MTK_ARM64_IMAGE_SIZE_OFFSET	(16)
+#define MTK_ARM64_IMAGE_MAGIC_OFFSET	(56)
+#define MTK_ARM64_IMAGE_MAGIC		(0x644d5241)	/* "ARM\x64" */
+
+static struct fdt_fixup boot_profile_fixup;
+
+static bool mtk_boot_profile_overlaps(uint64_t base, uint64_t end)
+{
+	return base < MTK_BOOT_PROFILE_BASE + MTK_BOOT_PROFILE_SIZE &&
+	       end > MTK_BOOT_PROFILE_BASE;
+}
+
+/*
+ * Map @len bytes of the kernel DTB at @pa. The DTB comes from the normal world,
+ * so it must not overlap the boot profile page, nor any secure memory.
+ */
+static int mtk_kernel_dtb_map(uintptr_t pa, size_t len, void **dtb)
+{
+	uintptr_t va;
+	int ret;
+
+	if (!len || pa + len < pa || mtk_boot_profile_overlaps(pa, pa + len))
+		return -EINVAL;
+
+	ret = mtk_ns_map(pa, len, MT_RW, &va);
+	if (ret)
+		return ret;
+
+	*dtb = (void *)va;
+
+	return 0;
+}
+
+/*
+ * Read the 32 or 64-bit address in property @name of /chosen, as U-Boot writes
+ * linux,initrd-start and linux,initrd-end. Returns -FDT_ERR_NOTFOUND without it.
+ */
+static int mtk_chosen_addr(const void *dtb, int chosen, const char *name,
+			   uint64_t *addr)
+{
+	const void *prop;
+	int len;
+
+	prop = fdt_getprop(dtb, chosen, name, &len);
+	if (!prop)
+		return len;
+
+	if (len == sizeof(fdt32_t))
+		*addr = fdt32_to_cpu(*(const fdt32_t *)prop);
+	else if (len == sizeof(fdt64_t))
+		*addr = fdt64_to_cpu(*(const fdt64_t *)prop);
+	else
+		return -FDT_ERR_BADVALUE;
+
+	return 0;
+}
+
+/*
+ * The boot profile page is ordinary non-secure DRAM, which the bootloader does
+ * not know BL31 writes to. Check that it holds neither the kernel at @pc nor
+ * the initrd the DTB points at, so that writing it does not corrupt them. The
+ * extent of the kernel is known from the arm64 Image header only, so AArch32
+ * kernels get no boot profile.
+ */
+static int mtk_boot_profile_check_kernel(const void *dtb, uintptr_t pc,
+					 bool aarch64)
+{
+	uint64_t image_size = 0, start, end;
+	uintptr_t va;
+	int chosen, ret;
+
+	if (!aarch64)
+		return -ENOTSUP;
+
+	ret = mtk_ns_map(pc, MTK_ARM64_IMAGE_HDR_SIZE, MT_RO, &va);
+	if (ret)
+		return ret;
+
+	if (*(uint32_t *)(va + MTK_ARM64_IMAGE_MAGIC_OFFSET) ==
+	    MTK_ARM64_IMAGE_MAGIC)
+		image_size = *(uint64_t *)(va + MTK_ARM64_IMAGE_SIZE_OFFSET);
+
+	(void)mtk_ns_unmap(va, MTK_ARM64_IMAGE_HDR_SIZE);
+
+	/* Kernels before v3.17 leave image_size at zero */
+	if (!image_size)
+		return -ENOTSUP;
+
+	if (mtk_boot_profile_overlaps(pc, pc + image_size))
+		return -EBUSY;
+
+	chosen = fdt_path_offset(dtb, "/chosen");
+	if (chosen < 0)
+		return 0;
+
+	if (mtk_chosen_addr(dtb, chosen, "linux,initrd-start", &start) ||
+	    mtk_chosen_addr(dtb, chosen, "linux,initrd-end", &end))
+		return 0;
+
+	if (mtk_boot_profile_overlaps(start, end))
+		return -EBUSY;
+
+	return 0;
+}
+
+/*
+ * Write the boot profile for the kernel at @pc, then reserve its page in the
+ * kernel DTB at @dtb_pa, and point the "mediatek,boot-profile" property of
+ * /chosen at the transfer list in it. The arm64 boot protocol requires x1-x3
+ * to be zero, so the address cannot be passed in registers. The DTB must have
+ * been left with room for the edits, as U-Boot does.
+ */
+static int mtk_boot_profile_handoff(uintptr_t dtb_pa, uintptr_t pc,
+				    bool aarch64)
+{
+	struct fdt_fixup *fix = &boot_profile_fixup;
+	uint64_t tl_prop;
+	char name[32];
+	uintptr_t tl;
+	size_t len;
+	void *dtb;
+	int chosen, ret;
+
+	/* Map the header to find the size of the DTB, then all of it */
+	ret = mtk_kernel_dtb_map(dtb_pa, sizeof(struct fdt_header), &dtb);
+	if (ret)
+		return ret;
+
+	ret = fdt_check_header(dtb);
+	len = fdt_totalsize(dtb);
+	(void)mtk_ns_unmap((uintptr_t)dtb, sizeof(struct fdt_header));
+
+	if (ret)
+		return ret;
+
+	if (len > MTK_KERNEL_DTB_MAX_SIZE)
+		return -FDT_ERR_TRUNCATED;
+
+	ret = mtk_kernel_dtb_map(dtb_pa, len, &dtb);
+	if (ret)
+		return ret;
+
+	ret = mtk_boot_profile_check_kernel(dtb, pc, aarch64);
+	if (ret)
+		goto out;
+
+	tl = mtk_boot_profile_tl();
+	if (!tl) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	tl_prop = cpu_to_fdt64(tl);
+	snprintf(name, sizeof(name), "boot-profile@%lx",
+		 (unsigned long)MTK_BOOT_PROFILE_BASE);
+
+	fdt_fixup_init(fix, dtb);
+	(void)fdt_fixup_reserved_memory(fix, name, MTK_BOOT_PROFILE_BASE,
+					MTK_BOOT_PROFILE_SIZE);
+
+	chosen = fdt_path_offset(dtb, "/chosen");
+	if (chosen < 0)
+		chosen = fdt_fixup_add_subnode(fix, 0, "chosen");
+
+	(void)fdt_fixup_setprop(fix, chosen, "mediatek,boot-profile",
+				&tl_prop, sizeof(tl_prop));
+
+	ret = fdt_fixup_commit(fix);
+	if (!ret) {
+		/* The kernel starts with its caches off */
+		flush_dcache_range((uintptr_t)dtb, fdt_totalsize(dtb));
+	}
+
+out:
+	(void)mtk_ns_unmap((uintptr_t)dtb, len);
+
+	return ret;
+}
+#endif
+
 void boot_to_kernel(uint64_t pc, uint64_t r0, uint64_t r1, uint64_t aarch64)
 {
+#ifdef MTK_BOOT_PROFILE_ENABLE
+	int ret;
+#endif
 	uint32_t image_type;
 
 	if (kernel_boot_once_flag)
@@ -76,6 +304,13 @@ void boot_to_kernel(uint64_t pc, uint64_t r0, uint64_t r1, uint64_t aarch64)
 		bl33k_ep_info.args.arg2 = r1;
 	}
 
+#ifdef MTK_BOOT_PROFILE_ENABLE
+	/* The DTB is in x0 for an AArch64 kernel, in r2 for an AArch32 one */
+	ret = mtk_boot_profile_handoff(aarch64 ? r0 : r1, pc, !!aarch64);
+	if (ret)
+		WARN("Boot profile not passed to the kernel: %d\n", ret);
+#endif
+
 	cm_init_my_context(&bl33k_ep_info);
 	cm_prepare_el3_exit(image_type);
 }
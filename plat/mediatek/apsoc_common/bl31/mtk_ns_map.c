@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <common/debug.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <platform_def.h>
+#include "mtk_ns_map.h"
+
+/* Static memory map of the platform, in aarch64/platform_common.c */
+extern const mmap_region_t plat_mmap[];
+
+static spinlock_t mtk_ns_map_lock;
+
+static bool mtk_ns_overlaps(uintptr_t pa, size_t size, uintptr_t base,
+			    size_t len)
+{
+	return pa < base + len && pa + size > base;
+}
+
+/*
+ * Whether [pa, pa + size) touches the secure DRAM holding BL31 and BL32, or
+ * any region of the platform memory map not mapped as non-secure.
+ */
+static bool mtk_ns_range_is_secure(uintptr_t pa, size_t size)
+{
+	const mmap_region_t *mm;
+
+	if (mtk_ns_overlaps(pa, size, TZRAM_BASE,
+			    TZRAM2_BASE + TZRAM2_SIZE - TZRAM_BASE))
+		return true;
+
+	for (mm = plat_mmap; mm->size; mm++) {
+		if (!(mm->attr & MT_NS) &&
+		    mtk_ns_overlaps(pa, size, mm->base_pa, mm->size))
+			return true;
+	}
+
+	return false;
+}
+
+int mtk_ns_map(uintptr_t pa, size_t len, uint32_t attr, uintptr_t *va)
+{
+	uintptr_t base_pa, base_va;
+	uint32_t cur_attr;
+	size_t size;
+	int ret;
+
+	if (!len || pa + len < pa || (attr & ~MT_RW))
+		return -EINVAL;
+
+	base_pa = round_down(pa, PAGE_SIZE);
+	size = round_up(pa + len, PAGE_SIZE) - base_pa;
+
+	if (mtk_ns_range_is_secure(base_pa, size))
+		return -EPERM;
+
+	spin_lock(&mtk_ns_map_lock);
+
+	ret = mmap_add_dynamic_region_alloc_va(base_pa, &base_va, size,
+					       MT_MEMORY | attr | MT_NS);
+	if (ret) {
+		ERROR("Mapping 0x%lx (0x%zx bytes) failed: %d\n",
+		      (unsigned long)base_pa, size, ret);
+		goto out;
+	}
+
+	if (xlat_get_mem_attributes(base_va, &cur_attr) ||
+	    !(cur_attr & MT_NS) || ((attr & MT_RW) && !(cur_attr & MT_RW))) {
+		(void)mmap_remove_dynamic_region(base_va, size);
+		ret = -EPERM;
+		goto out;
+	}
+
+	*va = base_va + (pa - base_pa);
+
+out:
+	spin_unlock(&mtk_ns_map_lock);
+
+	return ret;
+}
+
+int mtk_ns_unmap(uintptr_t va, size_t len)
+{
+	uintptr_t base_va = round_down(va, PAGE_SIZE);
+	size_t size = round_up(va + len, PAGE_SIZE) - base_va;
+	int ret;
+
+	spin_lock(&mtk_ns_map_lock);
+	ret = mmap_remove_dynamic_region(base_va, size);
+	spin_unlock(&mtk_ns_map_lock);
+
+	if (ret)
+		ERROR("Unmapping 0x%lx (0x%zx bytes) failed: %d\n",
+		      (unsigned long)base_va, size, ret);
+
+	return ret;
+}
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026, MediaTek Inc. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef MTK_NS_MAP_H
+#define MTK_NS_MAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Map the @len bytes of non-secure memory at @pa in BL31, readable, and
+ * writable if @attr is MT_RW. The whole range must stay clear of the secure
+ * DRAM and of every secure region of the platform memory map.
+ *
+ * All the dynamic regions of BL31 are added and removed through these calls,
+ * under one lock, since xlat_tables_v2 does not serialise them.
+ *
+ * Returns 0 and the address of @pa in @va, or a negative errno.
+ */
+int mtk_ns_map(uintptr_t pa, size_t len, uint32_t attr, uintptr_t *va);
+
+/* Unmap the @len bytes mapped at @va by mtk_ns_map() */
+int mtk_ns_unmap(uintptr_t va, size_t len);
+
+#endif /* MTK_NS_MAP_H */
@@ -4,8 +4,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <errno.h>
 #include <common/debug.h>
 #include <common/runtime_svc.h>
+#include <lib/pmf/pmf.h>
 #include <tools_share/uuid.h>
 
 #include "mtk_sip_svc.h"
@@ -19,24 +21,84 @@ DEFINE_SVC_UUID2(mtk_sip_svc_uid,
 	0xa42b58f7, 0x6242, 0x7d4d, 0x80, 0xe5,
 	0x8f, 0x95, 0x05, 0x00, 0x0f, 0x3d);
 
-static bool mtk_sip_call_dispatch(const struct mtk_sip_call_record *records,
-				  uint32_t count, uintptr_t *retval,
-				  uint32_t smc_fid, u_register_t x1,
-				  u_register_t x2, u_register_t x3,
-				  u_register_t x4, void *cookie, void *handle,
-				  u_register_t flags)
+/*
+ * Dense index of all SiP call records by SMC function number. An entry holds
+ * the position of the record in apsoc_common_sip_calls followed by
+ * mtk_plat_sip_calls, plus one, or 0 if the function number is not used.
+ */
+static uint8_t mtk_sip_call_index[MTK_SIP_CALL_NUM_MAX];
+
+static const struct mtk_sip_call_record *mtk_sip_call_get(uint32_t pos)
 {
-	uint32_t i;
+	if (pos < apsoc_common_sip_call_num)
+		return &apsoc_common_sip_calls[pos];
+
+	return &mtk_plat_sip_calls[pos - apsoc_common_sip_call_num];
+}
+
+static int32_t mtk_sip_svc_setup(void)
+{
+	const struct mtk_sip_call_record *rec;
+	uint32_t pos, num, count;
+
+#if ENABLE_PMF
+	if (pmf_setup() != 0)
+		return -EINVAL;
+#endif
+
+	count = apsoc_common_sip_call_num + mtk_plat_sip_call_num;
+	if (count > UINT8_MAX) {
+		ERROR("%s: too many SiP calls (%u)\n", __func__, count);
+		return -EINVAL;
+	}
+
+	for (pos = 0; pos < count; pos++) {
+		rec = mtk_sip_call_get(pos);
+		if (!rec->handler)
+			continue;
+
+		num = GET_SMC_NUM(rec->fid);
+
+		if (GET_SMC_OEN(rec->fid) != OEN_SIP_START ||
+		    GET_SMC_TYPE(rec->fid) != SMC_TYPE_FAST ||
+		    num >= MTK_SIP_CALL_NUM_MAX) {
+			ERROR("%s: invalid SiP call 0x%x\n", __func__,
+			      rec->fid);
+			return -EINVAL;
+		}
 
-	for (i = 0; i < count; i++) {
-		if (records[i].fid == smc_fid && records[i].handler) {
-			*retval = records[i].handler(smc_fid, x1, x2, x3, x4,
-						     cookie, handle, flags);
-			return true;
+		/* SMC32 and SMC64 variants share a function number */
+		if (mtk_sip_call_index[num]) {
+			ERROR("%s: duplicate SiP call 0x%x\n", __func__,
+			      rec->fid);
+			return -EINVAL;
 		}
+
+		mtk_sip_call_index[num] = pos + 1;
 	}
 
-	return false;
+	return 0;
+}
+
+static bool mtk_sip_call_dispatch(uintptr_t *retval, uint32_t smc_fid,
+				  u_register_t x1, u_register_t x2,
+				  u_register_t x3, u_register_t x4,
+				  void *cookie, void *handle,
+				  u_register_t flags)
+{
+	const struct mtk_sip_call_record *rec;
+	uint32_t num = GET_SMC_NUM(smc_fid);
+
+	if (num >= MTK_SIP_CALL_NUM_MAX || !mtk_sip_call_index[num])
+		return false;
+
+	rec = mtk_sip_call_get(mtk_sip_call_index[num] - 1);
+	if (rec->fid != smc_fid)
+		return false;
+
+	*retval = rec->handler(smc_fid, x1, x2, x3, x4, cookie, handle, flags);
+
+	return true;
 }
 
 /*
@@ -65,17 +127,7 @@ static uintptr_t mediatek_sip_handler(uint32_t smc_fid, u_register_t x1,
 	} else {
 		/* SiP SMC service normal world's call */
 
-		/* Try common services */
-		if (mtk_sip_call_dispatch(apsoc_common_sip_calls,
-					  apsoc_common_sip_call_num,
-					  &ret, smc_fid, x1, x2, x3, x4,
-					  cookie, handle, flags))
-			return ret;
-
-		/* Try platform-specific services */
-		if (mtk_sip_call_dispatch(mtk_plat_sip_calls,
-					  mtk_plat_sip_call_num,
-					  &ret, smc_fid, x1, x2, x3, x4,
+		if (mtk_sip_call_dispatch(&ret, smc_fid, x1, x2, x3, x4,
 					  cookie, handle, flags))
 			return ret;
 	}
@@ -92,6 +144,13 @@ static uintptr_t sip_smc_handler(uint32_t smc_fid, u_register_t x1,
 				 u_register_t x4, void *cookie, void *handle,
 				 u_register_t flags)
 {
+#if ENABLE_PMF
+	/* PMF calls share the SiP range, see is_pmf_fid() */
+	if (is_pmf_fid(smc_fid))
+		return pmf_smc_handler(smc_fid, x1, x2, x3, x4, cookie,
+				       handle, flags);
+#endif
+
 	switch (smc_fid) {
 	case SIP_SVC_CALL_COUNT:
 		/* Return the number of Mediatek SiP Service Calls. */
@@ -118,6 +177,6 @@ DECLARE_RT_SVC(
 	OEN_SIP_START,
 	OEN_SIP_END,
 	SMC_TYPE_FAST,
-	NULL,
+	mtk_sip_svc_setup,
 	sip_smc_handler
 );
@@ -40,4 +40,10 @@ struct mtk_sip_call_record {
 #define MTK_SIP_CALL_RECORD(_fid, _handler) \
 	{ .fid = (_fid), .handler = (_handler) }
 
+/*
+ * SiP calls are looked up through a table indexed by SMC function number, so
+ * the function number of every record must be below this limit.
+ */
+#define MTK_SIP_CALL_NUM_MAX			U(0x600)
+
 #endif /* MTK_SIP_SVC_H */
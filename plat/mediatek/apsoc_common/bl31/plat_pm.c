@@ -10,6 +10,9 @@
 
 #include <arch_helpers.h>
 #include <common/debug.h>
+#ifdef MTK_CONSOLE_RING
+#include <drivers/ring_console.h>
+#endif
 #include <lib/bakery_lock.h>
 #include <lib/psci/psci.h>
 #include <lib/mmio.h>
@@ -281,6 +284,26 @@ int mtk_plat_power_domain_on(unsigned long mpidr)
 	return PSCI_E_NOT_SUPPORTED;
 }
 
+#ifdef MTK_CONSOLE_RING
+/*******************************************************************************
+ * MTK_platform handlers called before a CPU is powered down, with its data
+ * cache still on. Send what it logged, which would otherwise stay in its ring
+ * until another CPU logs something.
+ ******************************************************************************/
+static int mtk_plat_power_domain_off_early(const psci_power_state_t *state)
+{
+	console_ring_drain();
+
+	return PSCI_E_SUCCESS;
+}
+
+static void mtk_plat_power_domain_suspend_pwrdown_early(
+				const psci_power_state_t *state)
+{
+	console_ring_drain();
+}
+#endif
+
 /*******************************************************************************
  * MTK_platform handler called when an affinity instance is about to be turned
  * off. The level and mpidr determine the affinity instance. The 'state' arg.
@@ -473,6 +496,11 @@ static const plat_psci_ops_t plat_plat_pm_ops = {
 	.pwr_domain_on_finish		= mtk_plat_power_domain_on_finish,
 	.pwr_domain_off			= mtk_plat_power_domain_off,
 	.pwr_domain_suspend		= mtk_plat_power_domain_suspend,
+#ifdef MTK_CONSOLE_RING
+	.pwr_domain_off_early		= mtk_plat_power_domain_off_early,
+	.pwr_domain_suspend_pwrdown_early =
+				mtk_plat_power_domain_suspend_pwrdown_early,
+#endif
 	.pwr_domain_suspend_finish	= mtk_plat_power_domain_suspend_finish,
 	.system_off			= mtk_plat_system_off,
 	.system_reset			= mtk_plat_system_reset,
@@ -0,0 +1,23 @@
+#
+# Copyright (c) 2026, MediaTek Inc. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# Buffer the UART output of BL2 and BL31 in per-CPU rings, drained while the
+# UART FIFO has room, on console flush and by the crash console before it
+# prints a crash report. In BL31, a CPU also drains its ring before it is
+# powered down, and the other CPUs' rings when it logs. BL31 keeps its rings
+# at MTK_CONSOLE_RING_BASE and only uses them once its MMU is enabled.
+CONSOLE_RING		?=	0
+
+$(eval $(call assert_boolean,CONSOLE_RING))
+
+ifeq ($(CONSOLE_RING),1)
+BL2_SOURCES		+=	drivers/console/ring_console.c			\
+				drivers/console/aarch64/ring_console_crash.S
+BL31_SOURCES		+=	drivers/console/ring_console.c			\
+				drivers/console/aarch64/ring_console_crash.S
+BL2_CPPFLAGS		+=	-DMTK_CONSOLE_RING
+BL31_CPPFLAGS		+=	-DMTK_CONSOLE_RING
+endif # END OF CONSOLE_RING
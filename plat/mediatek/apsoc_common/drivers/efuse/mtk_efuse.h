@@ -16,6 +16,7 @@
 #define MTK_EFUSE_ERROR_EFUSE_LEN_EXCEED_BUFFER_LEN		0x00000004
 #define MTK_EFUSE_ERROR_READ_EFUSE_FIELD_FAIL			0x00000005
 #define MTK_EFUSE_ERROR_WRITE_EFUSE_FIELD_FAIL			0x00000006
+#define MTK_EFUSE_ERROR_INVALIDE_SHM_BUFFER			0x00000007
 
 /* use to offset efuse r/w api error code */
 #define MTK_EFUSE_ERROR_CODE_OFFSET				0x0000000A
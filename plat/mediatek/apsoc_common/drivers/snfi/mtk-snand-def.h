@@ -178,6 +178,9 @@ struct mtk_snand {
 	uint8_t *page_cache;	/* Used by read/write page */
 	uint8_t *buf_cache;	/* Used by block bad/markbad & auto_oob */
 	int *sect_bf;		/* Used by ECC correction */
+
+	uint32_t read_retries;	/* Reads repeated for sample delay calibration */
+	uint32_t ecc_corrected;	/* Bitflips corrected, summed over all sectors */
 };
 
 enum mtk_snand_log_category {
@@ -732,6 +732,7 @@ static int mtk_snand_check_ecc_result(struct mtk_snand *snf, uint32_t page)
 		if (snf->sect_bf[i] >= 0) {
 			if (snf->sect_bf[i] > max_bitflips)
 				max_bitflips = snf->sect_bf[i];
+			snf->ecc_corrected += snf->sect_bf[i];
 			continue;
 		}
 
@@ -751,6 +752,7 @@ static int mtk_snand_check_ecc_result(struct mtk_snand *snf, uint32_t page)
 
 			if (snf->sect_bf[i] > max_bitflips)
 				max_bitflips = snf->sect_bf[i];
+			snf->ecc_corrected += rc;
 
 			snand_log_ecc(snf->pdev,
 			      "%u bitflip%s corrected in page %u sect %u\n",
@@ -945,6 +947,7 @@ retry:
 	if (ret == -EBADMSG && retry_cnt < 16) {
 		nfi_write32(snf, SNF_DLY_CTL3, retry_cnt * 2);
 		retry_cnt++;
+		snf->read_retries++;
 		goto retry;
 	}
 
@@ -1532,6 +1535,22 @@ int mtk_snand_get_chip_info(struct mtk_snand *snf,
 	return 0;
 }
 
+uint32_t mtk_snand_get_read_retries(struct mtk_snand *snf)
+{
+	if (!snf)
+		return 0;
+
+	return snf->read_retries;
+}
+
+uint32_t mtk_snand_get_ecc_corrected(struct mtk_snand *snf)
+{
+	if (!snf)
+		return 0;
+
+	return snf->ecc_corrected;
+}
+
 int mtk_snand_irq_process(struct mtk_snand *snf)
 {
 	uint32_t sta, ien;
@@ -1904,6 +1923,7 @@ int mtk_snand_init(void *dev, const struct mtk_snand_platdata *pdata,
 
 	snf->sect_bf = (int *)((uintptr_t)snf + sizeof(*snf));
 	snf->buf_cache = (uint8_t *)((uintptr_t)snf->sect_bf + sect_bf_size);
+	snf->read_retries = 0;
 
 	/* Allocate memory for DMA buffer */
 	snf->page_cache = dma_mem_alloc(dev, rawpage_size);
@@ -75,5 +75,7 @@ int mtk_snand_write_page_auto_oob(struct mtk_snand *snf, uint64_t addr,
 int mtk_snand_get_chip_info(struct mtk_snand *snf,
 			    struct mtk_snand_chip_info *info);
 int mtk_snand_irq_process(struct mtk_snand *snf);
+uint32_t mtk_snand_get_read_retries(struct mtk_snand *snf);
+uint32_t mtk_snand_get_ecc_corrected(struct mtk_snand *snf);
 
 #endif /* _MTK_SNAND_H_ */
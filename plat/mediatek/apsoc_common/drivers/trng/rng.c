@@ -5,10 +5,15 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <drivers/delay_timer.h>
 #include <lib/mmio.h>
 #include <lib/spinlock.h>
 #include <common/debug.h>
+#if TRNG_SUPPORT
+#include <lib/smccc.h>
+#include <plat/common/plat_trng.h>
+#endif
 #include "rng.h"
 
 static spinlock_t rng_lock;
@@ -88,3 +93,82 @@ uint32_t plat_get_rnd(uint32_t *val)
 
 	return ret;
 }
+
+#if TRNG_SUPPORT
+DEFINE_SVC_UUID2(_plat_trng_uuid,
+	0x670502d7, 0x631f, 0x482d, 0x80, 0x1c,
+	0x27, 0x84, 0xce, 0xd7, 0x82, 0x48
+);
+uuid_t plat_trng_uuid;
+
+void plat_entropy_setup(void)
+{
+	plat_trng_uuid = _plat_trng_uuid;
+}
+
+/*
+ * plat_trng_raw - read 32 bits of the NRBG noise source
+ * output - rand: 32-bit rnd
+ *
+ * SMCCC TRNG must hand out entropy, not the output of the DRBG seeded with
+ * it, so read the raw NRBG output. A failed health test is reported rather
+ * than retried: the caller then returns TRNG_E_NO_ENTROPY.
+ */
+static int plat_trng_raw(uint32_t *rand)
+{
+	uint64_t time = timeout_init_us(MTK_TIMEOUT_POLL);
+	uint32_t status;
+
+	mmio_setbits_32(RNG_EN, NRBG_EN | RAW_EN);
+
+	do {
+		status = mmio_read_32(RNG_STATUS);
+		if (status & RNG_ERROR) {
+			ERROR("%s: trng health test failed\n", __func__);
+			plat_trng_external_swrst();
+			return -EIO;
+		}
+
+		if (timeout_elapsed(time)) {
+			ERROR("%s: trng NOT ready\n", __func__);
+			return -EAGAIN;
+		}
+	} while (!(status & RAW_VALID));
+
+	*rand = mmio_read_32(RNG_RAW);
+
+	return 0;
+}
+
+/*
+ * plat_get_entropy_bulk - fill the SMCCC TRNG entropy pool
+ * output - out: up to nwords 64-bit words of rnd
+ *
+ * Takes rng_lock once for the whole refill rather than once per 32-bit word.
+ * There is a single noise source, so refills of the per-CPU pools still
+ * serialize here; only requests served from a pool avoid the lock.
+ */
+unsigned int plat_get_entropy_bulk(uint64_t *out, unsigned int nwords)
+{
+	uint32_t lo, hi;
+	unsigned int i;
+
+	spin_lock(&rng_lock);
+
+	for (i = 0; i < nwords; i++) {
+		if (plat_trng_raw(&lo) || plat_trng_raw(&hi))
+			break;
+
+		out[i] = ((uint64_t)hi << 32) | lo;
+	}
+
+	spin_unlock(&rng_lock);
+
+	return i;
+}
+
+bool plat_get_entropy(uint64_t *out)
+{
+	return plat_get_entropy_bulk(out, 1) == 1;
+}
+#endif /* TRNG_SUPPORT */
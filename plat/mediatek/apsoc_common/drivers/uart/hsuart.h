@@ -59,6 +59,7 @@ int console_hsuart_register(uintptr_t base, uint32_t clock,
 			    console_t *console);
 int console_hsuart_lbc_register(uintptr_t base, uint32_t clock,
 				uint32_t baud, console_t *console);
+int console_hsuart_tx_ready(console_t *console);
 #endif
 
 #endif /* _MTK_HSUART_H_ */
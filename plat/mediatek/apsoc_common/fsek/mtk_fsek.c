@@ -14,6 +14,7 @@
 #include <mbedtls/platform_util.h>
 #include <mbedtls/cipher.h>
 #include "mbedtls_helper.h"
+#include "mtk_ns_map.h"
 #include "mtk_huk.h"
 #include "mtk_roek.h"
 #include "mtk_fsek.h"
@@ -266,9 +267,7 @@ uint64_t mtk_fsek_decrypt_rfsk(void)
 	}
 	dec_rfsk_exec = true;
 
-	stat = mmap_add_dynamic_region_alloc_va(shm_paddr & TABLE_ADDR_MASK,
-						&shm_vaddr, shm_size,
-						MT_MEMORY | MT_RO | MT_NS);
+	stat = mtk_ns_map(shm_paddr, shm_size, MT_RO, &shm_vaddr);
 	if (stat) {
 		ERROR("FSEK: Mapping region failed: %d\n", stat);
 		ret = MTK_FSEK_ERR_MAP;
@@ -281,7 +280,7 @@ uint64_t mtk_fsek_decrypt_rfsk(void)
 
 	mbedtls_deinit();
 
-	stat = mmap_remove_dynamic_region(shm_vaddr, shm_size);
+	stat = mtk_ns_unmap(shm_vaddr, shm_size);
 	if (stat) {
 		ERROR("FSEK: Unmapping region failed: %d\n", stat);
 		ret |= MTK_FSEK_ERR_UNMAP;
@@ -44,3 +44,7 @@ BL31_SOURCES		+=	lib/xlat_tables/xlat_tables_common.c		\
 				plat/common/plat_gicv2.c
 
 BL31_CPPFLAGS		+=	-I$(APSOC_COMMON)/bl31
+
+ifeq (${ENABLE_PMF},1)
+BL31_SOURCES		+=	lib/pmf/pmf_smc.c
+endif
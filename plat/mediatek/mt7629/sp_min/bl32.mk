@@ -24,3 +24,7 @@ BL32_SOURCES		+=	lib/xlat_tables/xlat_tables_common.c		\
 				lib/xlat_tables/aarch32/xlat_tables.c
 
 BL32_CPPFLAGS		+=	-I$(APSOC_COMMON)/bl31
+
+ifeq (${ENABLE_PMF},1)
+BL32_SOURCES		+=	lib/pmf/pmf_smc.c
+endif
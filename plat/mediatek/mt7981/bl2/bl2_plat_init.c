@@ -14,6 +14,14 @@
 #include <timer.h>
 #include <emi.h>
 #include <mtk_wdt.h>
+#ifdef MTK_BL2_MP
+#include <errno.h>
+#include <arch_helpers.h>
+#include <cortex_a53.h>
+#include <mcucfg.h>
+#include <mtspmc.h>
+#include <bl2_mp.h>
+#endif
 
 static void mt7981_pll_init(void)
 {
@@ -55,6 +63,50 @@ static void mtk_pcie_init(void)
 	mmio_write_32(0x1000301c, 0x00000000);
 }
 
+#ifdef MTK_BL2_MP
+static bool spmc_initialized;
+
+int mtk_plat_bl2_cpu_on(unsigned int cpu, uintptr_t entrypoint)
+{
+	uintptr_t rv;
+
+	switch (cpu) {
+	case 0:
+		rv = (uintptr_t)&mt7981_mcucfg->mp0_misc_config2;
+		break;
+	case 1:
+		rv = (uintptr_t)&mt7981_mcucfg->mp0_misc_config4;
+		break;
+	default:
+		return -ENODEV;
+	}
+
+	if (!spmc_initialized) {
+		spmc_init();
+		spmc_initialized = true;
+	}
+
+	mmio_setbits_32((uintptr_t)&mt7981_mcucfg->mp0_misc_config3,
+			MP0_CPUCFG_64BIT);
+	mmio_write_32(rv, entrypoint);
+
+	spmc_cpu_corex_onoff(cpu, STA_POWER_ON, MODE_SPMC_HW);
+
+	return 0;
+}
+
+void mtk_plat_bl2_cpu_off(unsigned int cpu)
+{
+	/* The core is powered down by SPMC once it enters WFI */
+	spmc_cpu_corex_onoff(cpu, STA_POWER_DOWN, MODE_AUTO_SHUT_OFF);
+
+	/* Leave the coherency domain, the D-cache is already off in BL2 */
+	write_a53_cpuectlr_el1(read_a53_cpuectlr_el1() & ~CORTEX_A53_ECTLR_SMP_BIT);
+	isb();
+	dsb();
+}
+#endif
+
 void bl2_el3_plat_arch_setup(void)
 {
 }
@@ -41,5 +41,12 @@ BL31_SOURCES		+=	lib/xlat_tables/xlat_tables_common.c		\
 BL31_CPPFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC
 BL31_CPPFLAGS		+=	-I$(APSOC_COMMON)/bl31
 
+ifeq (${ENABLE_PMF},1)
+BL31_SOURCES		+=	lib/pmf/pmf_smc.c
+endif
+
+# SMCCC TRNG, backed by the NRBG of the hardware RNG, is left to the build
+# command line: TRNG_SUPPORT=1, and TRNG_PER_CPU_POOL=1 for one pool per CPU
+
 MTK_SIP_KERNEL_BOOT_ENABLE := 1
 $(eval $(call add_define,MTK_SIP_KERNEL_BOOT_ENABLE))
@@ -10,6 +10,7 @@
 #include <plat/common/platform.h>
 #include <plat/common/common_def.h>
 #include <plat_private.h>
+#include <bl31_common_setup.h>
 #include <mcucfg.h>
 #include <mtspmc.h>
 #include <mtk_gic_v3.h>
@@ -98,4 +99,8 @@ void bl31_plat_arch_setup(void)
 			       BL_CODE_END,
 			       BL_COHERENT_RAM_BASE,
 			       BL_COHERENT_RAM_END);
+
+#ifdef MTK_CONSOLE_RING
+	mtk_console_ring_setup();
+#endif
 }
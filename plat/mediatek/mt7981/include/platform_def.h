@@ -111,6 +111,14 @@
 #define FIP_DECOMP_TEMP_BASE	(0x42000000)
 #define FIP_DECOMP_TEMP_SIZE	(0x400000)
 
+/*******************************************************************************
+ * Console rings (CONSOLE_RING=1). BL31 keeps them in the unused TZRAM page
+ * below its base, BL2 in its own SRAM since DRAM is not up yet when the console
+ * is registered.
+ ******************************************************************************/
+#define MTK_CONSOLE_RING_SIZE	(0x1000)
+#define MTK_CONSOLE_RING_BASE	(TZRAM_BASE)
+
 /*******************************************************************************
  * Platform specific page table and MMU setup constants
  ******************************************************************************/
@@ -39,6 +39,7 @@ include $(MTK_PLAT_SOC)/bl2pl/bl2pl.mk
 include $(MTK_PLAT_SOC)/bl2/bl2.mk
 include $(MTK_PLAT_SOC)/bl31/bl31.mk
 include $(MTK_PLAT_SOC)/drivers/efuse/efuse.mk
+include $(APSOC_COMMON)/console_ring.mk
 
 include $(APSOC_COMMON)/bl2/tbbr_post.mk
 include $(APSOC_COMMON)/bl2/ar_post.mk
@@ -49,8 +50,8 @@ include make_helpers/dep.mk
 
 $(call GEN_DEP_RULES,bl2,emicfg bl2_boot_ram bl2_boot_nand_nmbm bl2_dev_mmc mtk_efuse bl2_plat_init bl2_plat_setup mt7981_gpio dtb)
 $(call MAKE_DEP,bl2,emicfg,DRAM_USE_DDR4 DRAM_SIZE_LIMIT DRAM_DEBUG_LOG DDR3_FREQ_2133 DDR3_FREQ_1866 BOARD_QFN BOARD_BGA)
-$(call MAKE_DEP,bl2,bl2_plat_init,BL2_COMPRESS)
-$(call MAKE_DEP,bl2,bl2_plat_setup,BOOT_DEVICE TRUSTED_BOARD_BOOT)
+$(call MAKE_DEP,bl2,bl2_plat_init,BL2_COMPRESS BL2_MP)
+$(call MAKE_DEP,bl2,bl2_plat_setup,BOOT_DEVICE TRUSTED_BOARD_BOOT BL33_XZ_DECOMP BL2_MP)
 $(call MAKE_DEP,bl2,bl2_dev_mmc,BOOT_DEVICE)
 $(call MAKE_DEP,bl2,bl2_boot_ram,RAM_BOOT_DEBUGGER_HOOK RAM_BOOT_UART_DL)
 $(call MAKE_DEP,bl2,bl2_boot_nand_nmbm,NMBM_MAX_RATIO NMBM_MAX_RESERVED_BLOCKS NMBM_DEFAULT_LOG_LEVEL)
@@ -26,6 +26,10 @@ const mmap_region_t plat_mmap[] = {
 	MAP_GIC,
 	MAP_DEVICE0,
 	MAP_DEVICE1,
+#ifdef MTK_BOOT_PROFILE_ENABLE
+	MAP_REGION_FLAT(MTK_BOOT_PROFILE_BASE, MTK_BOOT_PROFILE_SIZE,
+			MT_MEMORY | MT_RW | MT_NS),
+#endif
 	{ 0 }
 };
 
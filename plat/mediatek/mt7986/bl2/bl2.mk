@@ -60,6 +60,12 @@ include $(APSOC_COMMON)/bl2/tbbr.mk
 # Anti-rollback
 include $(APSOC_COMMON)/bl2/ar.mk
 
+# BL33 decompression
+include $(APSOC_COMMON)/bl2/decomp.mk
+
+# Secondary cores in BL2
+include $(APSOC_COMMON)/bl2/mp.mk
+
 ifeq ($(BL2_COMPRESS),1)
 BL2_CPPFLAGS		+=	-DUSING_BL2PL
 endif # END OF BL2_COMPRESS
@@ -17,6 +17,14 @@
 #ifdef I2C_SUPPORT
 #include <mt_i2c.h>
 #endif
+#ifdef MTK_BL2_MP
+#include <errno.h>
+#include <arch_helpers.h>
+#include <cortex_a53.h>
+#include <mcucfg.h>
+#include <mtspmc.h>
+#include <bl2_mp.h>
+#endif
 
 /* setup clock mux/gate to default value in bl2 */
 static void mtk_clock_init(void)
@@ -79,6 +87,56 @@ static void mt7986_i2c_init(void)
 #endif
 }
 
+#ifdef MTK_BL2_MP
+static bool spmc_initialized;
+
+int mtk_plat_bl2_cpu_on(unsigned int cpu, uintptr_t entrypoint)
+{
+	uintptr_t rv;
+
+	switch (cpu) {
+	case 0:
+		rv = (uintptr_t)&mt7986_mcucfg->mp0_misc_config2;
+		break;
+	case 1:
+		rv = (uintptr_t)&mt7986_mcucfg->mp0_misc_config4;
+		break;
+	case 2:
+		rv = (uintptr_t)&mt7986_mcucfg->mp0_misc_config6;
+		break;
+	case 3:
+		rv = (uintptr_t)&mt7986_mcucfg->mp0_misc_config8;
+		break;
+	default:
+		return -ENODEV;
+	}
+
+	if (!spmc_initialized) {
+		spmc_init();
+		spmc_initialized = true;
+	}
+
+	mmio_setbits_32((uintptr_t)&mt7986_mcucfg->mp0_misc_config3,
+			MP0_CPUCFG_64BIT);
+	mmio_write_32(rv, entrypoint);
+
+	spmc_cpu_corex_onoff(cpu, STA_POWER_ON, MODE_SPMC_HW);
+
+	return 0;
+}
+
+void mtk_plat_bl2_cpu_off(unsigned int cpu)
+{
+	/* The core is powered down by SPMC once it enters WFI */
+	spmc_cpu_corex_onoff(cpu, STA_POWER_DOWN, MODE_AUTO_SHUT_OFF);
+
+	/* Leave the coherency domain, the D-cache is already off in BL2 */
+	write_a53_cpuectlr_el1(read_a53_cpuectlr_el1() & ~CORTEX_A53_ECTLR_SMP_BIT);
+	isb();
+	dsb();
+}
+#endif
+
 void bl2_el3_plat_arch_setup(void)
 {
 }
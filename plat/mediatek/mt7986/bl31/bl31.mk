@@ -23,6 +23,7 @@ BL31_SOURCES		+=	drivers/arm/cci/cci.c				\
 				$(APSOC_COMMON)/bl31/mtk_boot_next.c		\
 				$(APSOC_COMMON)/bl31/bl31_common_setup.c	\
 				$(APSOC_COMMON)/bl31/apsoc_sip_svc_common.c	\
+				$(APSOC_COMMON)/bl31/mtk_ns_map.c		\
 				$(APSOC_COMMON)/bl31/plat_topology.c		\
 				$(APSOC_COMMON)/bl31/mtk_gic_v3.c		\
 				$(APSOC_COMMON)/bl31/plat_pm.c			\
@@ -41,7 +42,28 @@ BL31_SOURCES		+=	$(XLAT_TABLES_LIB_SRCS)
 BL31_CPPFLAGS		+=	-DPLAT_XLAT_TABLES_DYNAMIC
 BL31_CPPFLAGS		+=	-I$(APSOC_COMMON)/bl31
 
+ifeq (${ENABLE_PMF},1)
+BL31_SOURCES		+=	lib/pmf/pmf_smc.c
+endif
+
+# Boot profile handoff to the kernel (BOOT_TIME_INSTRUMENTATION=1), through
+# its DTB, needs dynamic xlat regions to map the DTB
+include lib/transfer_list/transfer_list.mk
+
+ifeq (${BOOT_TIME_INSTRUMENTATION}${TRANSFER_LIST},11)
+include common/fdt_wrappers.mk
+BL31_SOURCES		+=	common/fdt_fixup.c				\
+				${FDT_WRAPPERS_SOURCES}
+
+MTK_BOOT_PROFILE_ENABLE := 1
+$(eval $(call add_define,MTK_BOOT_PROFILE_ENABLE))
+endif
+
 include $(APSOC_COMMON)/fsek/fsek.mk
 
 MTK_SIP_KERNEL_BOOT_ENABLE := 1
 $(eval $(call add_define,MTK_SIP_KERNEL_BOOT_ENABLE))
+
+# eFuse SiP calls through non-secure shared memory, needs dynamic xlat regions
+MTK_EFUSE_SHM_ENABLE := 1
+$(eval $(call add_define,MTK_EFUSE_SHM_ENABLE))
@@ -108,6 +108,22 @@
 #define FIP_DECOMP_TEMP_BASE	(0x42000000)
 #define FIP_DECOMP_TEMP_SIZE	(0x400000)
 
+/*******************************************************************************
+ * Boot profile transfer list passed to the kernel, in non-secure DRAM right
+ * below TZRAM. Nothing reserves it for BL33, so BL31 only writes it when the
+ * kernel, initrd and DTB are clear of it, then reserves it in the kernel DTB.
+ ******************************************************************************/
+#define MTK_BOOT_PROFILE_SIZE	(0x1000)
+#define MTK_BOOT_PROFILE_BASE	(TZRAM_BASE - MTK_BOOT_PROFILE_SIZE)
+
+/*******************************************************************************
+ * Console rings (CONSOLE_RING=1). BL31 keeps them in the unused TZRAM page
+ * below its base, BL2 in its own SRAM since DRAM is not up yet when the console
+ * is registered.
+ ******************************************************************************/
+#define MTK_CONSOLE_RING_SIZE	(0x1000)
+#define MTK_CONSOLE_RING_BASE	(TZRAM_BASE)
+
 /*******************************************************************************
  * Platform specific page table and MMU setup constants
  ******************************************************************************/
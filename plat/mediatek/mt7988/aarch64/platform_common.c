@@ -27,6 +27,10 @@ const mmap_region_t plat_mmap[] = {
 	MAP_REGION_FLAT(TZRAM_BASE, TZRAM_SIZE, MT_MEMORY | MT_RW | MT_SECURE),
 	MAP_REGION_FLAT(MTK_DEV_BASE, MTK_DEV_SIZE,
 			MT_DEVICE | MT_RW | MT_SECURE),
+#ifdef MTK_BOOT_PROFILE_ENABLE
+	MAP_REGION_FLAT(MTK_BOOT_PROFILE_BASE, MTK_BOOT_PROFILE_SIZE,
+			MT_MEMORY | MT_RW | MT_NS),
+#endif
 	{ 0 }
 };
 
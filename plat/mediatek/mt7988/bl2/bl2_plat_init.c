@@ -21,6 +21,14 @@
 #include <mt_i2c.h>
 #include "mt6682a.h"
 #endif
+#ifdef MTK_BL2_MP
+#include <errno.h>
+#include <arch_helpers.h>
+#include <cortex_a73.h>
+#include <mcucfg.h>
+#include <mtspmc.h>
+#include <bl2_mp.h>
+#endif
 
 #define CHN_EMI_TESTB 0x10236048
 #define EMI_TESTB     0x102190e8
@@ -160,6 +168,56 @@ static void mtk_eip197_init(void)
 #endif
 }
 
+#ifdef MTK_BL2_MP
+static bool spmc_initialized;
+
+int mtk_plat_bl2_cpu_on(unsigned int cpu, uintptr_t entrypoint)
+{
+	uintptr_t rv;
+
+	switch (cpu) {
+	case 0:
+		rv = (uintptr_t)&mt7988_mcucfg->rvaddr0_l;
+		break;
+	case 1:
+		rv = (uintptr_t)&mt7988_mcucfg->rvaddr1_l;
+		break;
+	case 2:
+		rv = (uintptr_t)&mt7988_mcucfg->rvaddr2_l;
+		break;
+	case 3:
+		rv = (uintptr_t)&mt7988_mcucfg->rvaddr3_l;
+		break;
+	default:
+		return -ENODEV;
+	}
+
+	if (!spmc_initialized) {
+		spmc_init();
+		spmc_initialized = true;
+	}
+
+	mmio_setbits_32((uintptr_t)&mt7988_mcucfg->cpucfg,
+			MP0_CPUCFG_64BIT);
+	mmio_write_32(rv, entrypoint);
+
+	spmc_cpu_corex_onoff(cpu, STA_POWER_ON, MODE_SPMC_HW);
+
+	return 0;
+}
+
+void mtk_plat_bl2_cpu_off(unsigned int cpu)
+{
+	/* The core is powered down by SPMC once it enters WFI */
+	spmc_cpu_corex_onoff(cpu, STA_POWER_DOWN, MODE_AUTO_SHUT_OFF);
+
+	/* Leave the coherency domain, the D-cache is already off in BL2 */
+	write_a73_cpuectlr_el1(read_a73_cpuectlr_el1() & ~CORTEX_A73_CPUECTLR_SMP_BIT);
+	isb();
+	dsb();
+}
+#endif
+
 void bl2_el3_plat_arch_setup(void)
 {
 	plat_mt_cpuxgpt_init();
@@ -9,6 +9,7 @@
 #include <plat/common/platform.h>
 #include <plat/common/common_def.h>
 #include <plat_private.h>
+#include <bl31_common_setup.h>
 #include <mcucfg.h>
 #include <mtspmc.h>
 #include <mtk_gic_v3.h>
@@ -44,4 +45,8 @@ void bl31_plat_arch_setup(void)
 	plat_configure_mmu_el3(BL_CODE_BASE, BL_COHERENT_RAM_END - BL_CODE_BASE,
 			       BL_CODE_BASE, BL_CODE_END, BL_COHERENT_RAM_BASE,
 			       BL_COHERENT_RAM_END);
+
+#ifdef MTK_CONSOLE_RING
+	mtk_console_ring_setup();
+#endif
 }
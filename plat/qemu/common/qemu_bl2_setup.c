@@ -52,6 +52,11 @@
 /* Data structure which holds the extents of the trusted SRAM for BL2 */
 static meminfo_t bl2_tzram_layout __aligned(CACHE_WRITEBACK_GRANULE);
 #if TRANSFER_LIST
+#if TRANSFER_LIST_INDEX
+/* Entries of the tag index of the transfer list handed off to BL33 */
+#define QEMU_TL_INDEX_ENTRIES	8U
+#endif
+
 static struct transfer_list_header *bl2_tl;
 #endif
 
@@ -124,6 +129,11 @@ void bl2_platform_setup(void)
 		ERROR("Failed to initialize Transfer List at 0x%lx\n",
 		      (unsigned long)FW_HANDOFF_BASE);
 	}
+#if TRANSFER_LIST_INDEX
+	if (bl2_tl && !transfer_list_add_index(bl2_tl, QEMU_TL_INDEX_ENTRIES)) {
+		WARN("Failed to add a tag index to Transfer List\n");
+	}
+#endif
 #endif
 	security_setup();
 	update_dt();
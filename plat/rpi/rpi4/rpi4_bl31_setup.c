@@ -243,6 +243,7 @@ static void remove_spintable_memreserve(void *dtb)
 
 static void rpi4_prepare_dtb(void)
 {
+	static struct fdt_fixup fix;
 	void *dtb = (void *)rpi4_get_dtb_address();
 	uint32_t gic_int_prop[3];
 	int ret, offs;
@@ -257,39 +258,54 @@ static void rpi4_prepare_dtb(void)
 		return;
 	}
 
-	if (dt_add_psci_node(dtb)) {
+	/* Apply the node and property changes below in one go */
+	fdt_fixup_init(&fix, dtb);
+
+	if (fdt_fixup_psci_node(&fix)) {
 		ERROR("Failed to add PSCI Device Tree node\n");
-		return;
+		goto out;
 	}
 
-	if (dt_add_psci_cpu_enable_methods(dtb)) {
+	if (fdt_fixup_psci_cpu_enable_methods(&fix)) {
 		ERROR("Failed to add PSCI cpu enable methods in Device Tree\n");
-		return;
+		goto out;
+	}
+
+	offs = fdt_node_offset_by_compatible(dtb, 0, "arm,gic-400");
+	gic_int_prop[0] = cpu_to_fdt32(1);		// PPI
+	gic_int_prop[1] = cpu_to_fdt32(9);		// PPI #9
+	gic_int_prop[2] = cpu_to_fdt32(0x0f04);		// all cores, level high
+	if (offs >= 0)
+		fdt_fixup_setprop(&fix, offs, "interrupts", gic_int_prop, 12);
+
+	offs = fdt_path_offset(dtb, "/chosen");
+	if (offs >= 0)
+		fdt_fixup_setprop_string(&fix, offs, "stdout-path", "serial0");
+
+	ret = fdt_fixup_commit(&fix);
+	if (ret < 0) {
+		ERROR("Failed to update Device Tree at %p: error %d\n", dtb, ret);
+		goto out;
 	}
 
 	/*
 	 * Remove the original reserved region (used for the spintable), and
 	 * replace it with a region describing the whole of Trusted Firmware.
+	 * This is done separately, so that a failure here leaves the PSCI
+	 * changes above in place.
 	 */
 	remove_spintable_memreserve(dtb);
 	if (fdt_add_reserved_memory(dtb, "atf@0", 0, 0x80000))
 		WARN("Failed to add reserved memory nodes to DT.\n");
 
-	offs = fdt_node_offset_by_compatible(dtb, 0, "arm,gic-400");
-	gic_int_prop[0] = cpu_to_fdt32(1);		// PPI
-	gic_int_prop[1] = cpu_to_fdt32(9);		// PPI #9
-	gic_int_prop[2] = cpu_to_fdt32(0x0f04);		// all cores, level high
-	fdt_setprop(dtb, offs, "interrupts", gic_int_prop, 12);
-
-	offs = fdt_path_offset(dtb, "/chosen");
-	fdt_setprop_string(dtb, offs, "stdout-path", "serial0");
+	INFO("Changed device tree to advertise PSCI.\n");
 
+out:
 	ret = fdt_pack(dtb);
 	if (ret < 0)
 		ERROR("Failed to pack Device Tree at %p: error %d\n", dtb, ret);
 
 	clean_dcache_range((uintptr_t)dtb, fdt_blob_size(dtb));
-	INFO("Changed device tree to advertise PSCI.\n");
 }
 
 void bl31_platform_setup(void)
@@ -431,6 +431,7 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 				void *handle, uint64_t flags)
 {
 	uint32_t src_sec_state;
+	uint64_t size;
 	int ret;
 
 	/* If RMM failed to boot, treat any RMM-EL3 interface SMC as unknown */
@@ -454,6 +455,20 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 	case RMM_GTSI_UNDELEGATE:
 		ret = gpt_undelegate_pas(x1, PAGE_SIZE_4KB, SMC_FROM_REALM);
 		SMC_RET1(handle, gpt_to_gts_error(ret, smc_fid, x1));
+	/*
+	 * At most GPT_TRANSITION_MAX_SIZE is transitioned per call, the RMM
+	 * calls again for the rest of the range.
+	 */
+	case RMM_GTSI_DELEGATE_RANGE:
+		size = MIN(x2, GPT_TRANSITION_MAX_SIZE);
+		ret = gpt_delegate_pas(x1, size, SMC_FROM_REALM);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid, x1),
+			 (ret == 0) ? size : 0UL);
+	case RMM_GTSI_UNDELEGATE_RANGE:
+		size = MIN(x2, GPT_TRANSITION_MAX_SIZE);
+		ret = gpt_undelegate_pas(x1, size, SMC_FROM_REALM);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid, x1),
+			 (ret == 0) ? size : 0UL);
 	case RMM_ATTEST_GET_PLAT_TOKEN:
 		ret = rmmd_attest_get_platform_token(x1, &x2, x3);
 		SMC_RET2(handle, ret, x2);
@@ -12,6 +12,16 @@
 
 #define MAP_OFF(_map, _mapping) ((_map) - (_mapping)->map)
 
+/*
+ * Interrupts up to the last SPI are looked up in sdei_intr_index, which holds
+ * the offset plus one of their mapping, and whether it is shared. Free
+ * dynamic mappings and interrupts beyond are searched for linearly.
+ */
+#define SDEI_INTR_INDEX_SIZE	1020U
+#define SDEI_INTR_INDEX_SHARED	0x8000U
+
+static uint16_t sdei_intr_index[SDEI_INTR_INDEX_SIZE];
+
 /*
  * Get SDEI entry with the given mapping: on success, returns pointer to SDEI
  * entry. On error, returns NULL.
@@ -51,6 +61,55 @@ sdei_entry_t *get_event_entry(sdei_ev_map_t *map)
 	}
 }
 
+/*
+ * Record the interrupt of a bound mapping in the interrupt index, called with
+ * the mapping locked when its interrupt is set.
+ */
+void sdei_intr_index_add(sdei_ev_map_t *map)
+{
+	const sdei_mapping_t *mapping;
+	uint16_t entry;
+
+	if ((map->intr == SDEI_DYN_IRQ) || (map->intr >= SDEI_INTR_INDEX_SIZE))
+		return;
+
+	if (is_event_shared(map)) {
+		mapping = SDEI_SHARED_MAPPING();
+		entry = SDEI_INTR_INDEX_SHARED;
+	} else {
+		mapping = SDEI_PRIVATE_MAPPING();
+		entry = 0U;
+	}
+
+	assert(mapping->num_maps < SDEI_INTR_INDEX_SHARED);
+	entry |= (uint16_t) (MAP_OFF(map, mapping) + 1);
+
+	sdei_intr_index[map->intr] = entry;
+}
+
+/* Remove the interrupt of a mapping from the interrupt index */
+void sdei_intr_index_remove(sdei_ev_map_t *map)
+{
+	if ((map->intr == SDEI_DYN_IRQ) || (map->intr >= SDEI_INTR_INDEX_SIZE))
+		return;
+
+	sdei_intr_index[map->intr] = 0U;
+}
+
+/* Build the interrupt index from the platform mappings */
+void sdei_intr_index_init(void)
+{
+	const sdei_mapping_t *mapping;
+	sdei_ev_map_t *map;
+	unsigned int i, j;
+
+	for_each_mapping_type(i, mapping) {
+		iterate_mapping(mapping, j, map) {
+			sdei_intr_index_add(map);
+		}
+	}
+}
+
 /*
  * Find event mapping for a given interrupt number: On success, returns pointer
  * to the event mapping. On error, returns NULL.
@@ -60,13 +119,27 @@ sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared)
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
 	unsigned int i;
+	uint16_t entry;
+
+	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
+
+	if ((intr_num != SDEI_DYN_IRQ) && (intr_num < SDEI_INTR_INDEX_SIZE)) {
+		entry = sdei_intr_index[intr_num];
+		if (entry == 0U)
+			return NULL;
+
+		if (((entry & SDEI_INTR_INDEX_SHARED) != 0U) == shared) {
+			map = &mapping->map[(entry & ~SDEI_INTR_INDEX_SHARED) - 1U];
+			if (map->intr == intr_num)
+				return map;
+		}
+	}
 
 	/*
 	 * Look for a match in private and shared mappings, as requested. This
-	 * is a linear search. However, if the mappings are required to be
-	 * sorted, for large maps, we could consider binary search.
+	 * is a linear search, used for free dynamic mappings and interrupts
+	 * that are not indexed.
 	 */
-	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
 	iterate_mapping(mapping, i, map) {
 		if (map->intr == intr_num)
 			return map;
@@ -83,17 +156,26 @@ sdei_ev_map_t *find_event_map(int ev_num)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i, j;
+	unsigned int i;
+	size_t lo, hi, mid;
 
 	/*
-	 * Iterate through mappings to find a match. This is a linear search.
-	 * However, if the mappings are required to be sorted, for large maps,
-	 * we could consider binary search.
+	 * Mappings are sorted by event number, which sdei_class_init()
+	 * asserts, so binary search each of them.
 	 */
 	for_each_mapping_type(i, mapping) {
-		iterate_mapping(mapping, j, map) {
+		lo = 0U;
+		hi = mapping->num_maps;
+		while (lo < hi) {
+			mid = lo + ((hi - lo) / 2U);
+			map = &mapping->map[mid];
 			if (map->ev_num == ev_num)
 				return map;
+
+			if (map->ev_num < ev_num)
+				lo = mid + 1U;
+			else
+				hi = mid;
 		}
 	}
 
@@ -20,6 +20,8 @@
 
 /**
  * struct spmc_shmem_obj - Shared memory object.
+ * @block_size:     Size of the block of @state->data holding this object.
+ * @free:           Set if the block holds no object.
  * @desc_size:      Size of @desc.
  * @desc_filled:    Size of @desc already received.
  * @in_use:         Number of clients that have called ffa_mem_retrieve_req
@@ -27,12 +29,29 @@
  * @desc:           FF-A memory region descriptor passed in ffa_mem_share.
  */
 struct spmc_shmem_obj {
+	size_t block_size;
+	bool free;
 	size_t desc_size;
 	size_t desc_filled;
 	size_t in_use;
 	struct ffa_mtd desc;
 };
 
+/*
+ * Number of slots of the index from handles to objects, a power of two. At
+ * most 3/4 of them are used, to keep the probe sequences short.
+ */
+#ifndef PLAT_SPMC_SHMEM_INDEX_SIZE
+#define PLAT_SPMC_SHMEM_INDEX_SIZE	U(512)
+#endif
+CASSERT(IS_POWER_OF_TWO(PLAT_SPMC_SHMEM_INDEX_SIZE),
+	assert_spmc_shmem_index_size_not_power_of_two);
+
+#define SPMC_SHMEM_INDEX_MAX_USED	((PLAT_SPMC_SHMEM_INDEX_SIZE * 3U) / 4U)
+
+/* Offset of the object in @state->data plus one, 0 for an empty slot */
+static uint32_t spmc_shmem_index[PLAT_SPMC_SHMEM_INDEX_SIZE];
+
 /*
  * Declare our data structure to store the metadata of memory share requests.
  * The main datastore is allocated on a per platform basis to ensure enough
@@ -44,6 +63,7 @@ struct spmc_shmem_obj {
 struct spmc_shmem_obj_state spmc_shmem_obj_state = {
 	/* Set start value for handle so top 32 bits are needed quickly. */
 	.next_handle = 0xffffffc0U,
+	.index = spmc_shmem_index,
 };
 
 /**
@@ -57,12 +77,82 @@ static size_t spmc_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct spmc_shmem_obj, desc);
 }
 
+static struct spmc_shmem_obj *
+spmc_shmem_obj_at(struct spmc_shmem_obj_state *state, size_t offset)
+{
+	return (struct spmc_shmem_obj *)(state->data + offset);
+}
+
+static size_t spmc_shmem_obj_offset(struct spmc_shmem_obj_state *state,
+				    struct spmc_shmem_obj *obj)
+{
+	return (size_t)((uint8_t *)obj - state->data);
+}
+
+/**
+ * spmc_shmem_obj_merge_free - Merge a free block with the free blocks after it.
+ * @state:      Global state.
+ * @obj:        Free block.
+ *
+ * If the merged block ends the allocated area, it is returned to the unused
+ * space at its end.
+ */
+static void spmc_shmem_obj_merge_free(struct spmc_shmem_obj_state *state,
+				      struct spmc_shmem_obj *obj)
+{
+	size_t offset = spmc_shmem_obj_offset(state, obj);
+	size_t next = offset + obj->block_size;
+
+	while ((next < state->allocated) &&
+	       spmc_shmem_obj_at(state, next)->free) {
+		obj->block_size += spmc_shmem_obj_at(state, next)->block_size;
+		next = offset + obj->block_size;
+	}
+
+	if (next == state->allocated) {
+		state->allocated = offset;
+	}
+}
+
+/**
+ * spmc_shmem_obj_find_free - Find a free block that can hold an object.
+ * @state:      Global state.
+ * @obj_size:   Size of the object.
+ *
+ * Return: First free block of at least @obj_size bytes, %NULL if there is none.
+ */
+static struct spmc_shmem_obj *
+spmc_shmem_obj_find_free(struct spmc_shmem_obj_state *state, size_t obj_size)
+{
+	size_t offset = 0U;
+
+	while (offset < state->allocated) {
+		struct spmc_shmem_obj *obj = spmc_shmem_obj_at(state, offset);
+
+		if (obj->free) {
+			spmc_shmem_obj_merge_free(state, obj);
+			if (offset >= state->allocated) {
+				break;
+			}
+			if (obj->block_size >= obj_size) {
+				return obj;
+			}
+		}
+		offset += obj->block_size;
+	}
+	return NULL;
+}
+
 /**
  * spmc_shmem_obj_alloc - Allocate struct spmc_shmem_obj.
  * @state:      Global state.
  * @desc_size:  Size of struct ffa_memory_region_descriptor object that
  *              allocated object will hold.
  *
+ * Objects are appended to the allocated area of @state->data while there is
+ * room for them, and otherwise go to the first block freed by a previous
+ * object that is large enough. Objects never move.
+ *
  * Return: Pointer to newly allocated object, or %NULL if there not enough space
  *         left. The returned pointer is only valid while @state is locked, to
  *         used it again after unlocking @state, spmc_shmem_obj_lookup must be
@@ -74,6 +164,7 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 	struct spmc_shmem_obj *obj;
 	size_t free = state->data_size - state->allocated;
 	size_t obj_size;
+	size_t block_size;
 
 	if (state->data == NULL) {
 		ERROR("Missing shmem datastore!\n");
@@ -96,45 +187,156 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 		return NULL;
 	}
 
-	if (obj_size > free) {
-		WARN("%s(0x%zx) failed, free 0x%zx\n",
-		     __func__, desc_size, free);
-		return NULL;
+	if (obj_size <= free) {
+		obj = spmc_shmem_obj_at(state, state->allocated);
+		block_size = obj_size;
+		state->allocated += obj_size;
+	} else {
+		obj = spmc_shmem_obj_find_free(state, obj_size);
+		if (obj != NULL) {
+			block_size = obj->block_size;
+		} else if (obj_size <= (state->data_size - state->allocated)) {
+			/* Free blocks at the end were given back */
+			obj = spmc_shmem_obj_at(state, state->allocated);
+			block_size = obj_size;
+			state->allocated += obj_size;
+		} else {
+			WARN("%s(0x%zx) failed, free 0x%zx\n",
+			     __func__, desc_size, free);
+			return NULL;
+		}
+	}
+
+	/* Split off the rest of a larger free block if it can hold a header */
+	if ((block_size - obj_size) >= spmc_shmem_obj_size(0U)) {
+		struct spmc_shmem_obj *rest = (struct spmc_shmem_obj *)
+					      ((uint8_t *)obj + obj_size);
+
+		rest->block_size = block_size - obj_size;
+		rest->free = true;
+		block_size = obj_size;
 	}
-	obj = (struct spmc_shmem_obj *)(state->data + state->allocated);
+
+	obj->block_size = block_size;
+	obj->free = false;
 	obj->desc = (struct ffa_mtd) {0};
 	obj->desc_size = desc_size;
 	obj->desc_filled = 0;
 	obj->in_use = 0;
-	state->allocated += obj_size;
 	return obj;
 }
 
+/**
+ * spmc_shmem_index_find - Find the index slot of a handle.
+ * @state:      Global state.
+ * @handle:     Handle to look for.
+ *
+ * Handles are allocated sequentially, so their low bits spread them evenly
+ * over the index, which is probed linearly.
+ *
+ * Return: Slot holding the object with handle @handle, or the empty slot that
+ *         ends its probe sequence.
+ */
+static size_t spmc_shmem_index_find(struct spmc_shmem_obj_state *state,
+				    uint64_t handle)
+{
+	size_t mask = PLAT_SPMC_SHMEM_INDEX_SIZE - 1U;
+	size_t slot = (size_t)handle & mask;
+
+	while (state->index[slot] != 0U) {
+		struct spmc_shmem_obj *obj =
+			spmc_shmem_obj_at(state, state->index[slot] - 1U);
+
+		if (obj->desc.handle == handle) {
+			break;
+		}
+		slot = (slot + 1U) & mask;
+	}
+	return slot;
+}
+
+/**
+ * spmc_shmem_index_add - Make an object reachable by its handle.
+ * @state:      Global state.
+ * @obj:        Object with a handle no other indexed object has.
+ *
+ * Return: %true on success, %false if the index is full.
+ */
+static bool spmc_shmem_index_add(struct spmc_shmem_obj_state *state,
+				 struct spmc_shmem_obj *obj)
+{
+	size_t slot;
+
+	if (state->index_used >= SPMC_SHMEM_INDEX_MAX_USED) {
+		WARN("%s: shmem index full\n", __func__);
+		return false;
+	}
+
+	slot = spmc_shmem_index_find(state, obj->desc.handle);
+	assert(state->index[slot] == 0U);
+
+	state->index[slot] = (uint32_t)spmc_shmem_obj_offset(state, obj) + 1U;
+	state->index_used++;
+	return true;
+}
+
+/**
+ * spmc_shmem_index_remove - Remove an object from the index.
+ * @state:      Global state.
+ * @obj:        Object to remove. Nothing is done if it is not indexed.
+ *
+ * The entries that follow in the probe sequence are moved back into the hole,
+ * so that lookups never need to skip deleted entries.
+ */
+static void spmc_shmem_index_remove(struct spmc_shmem_obj_state *state,
+				    struct spmc_shmem_obj *obj)
+{
+	size_t mask = PLAT_SPMC_SHMEM_INDEX_SIZE - 1U;
+	size_t hole = spmc_shmem_index_find(state, obj->desc.handle);
+	size_t slot = hole;
+
+	if (state->index[hole] !=
+	    (uint32_t)spmc_shmem_obj_offset(state, obj) + 1U) {
+		return;
+	}
+
+	for (;;) {
+		size_t home;
+
+		slot = (slot + 1U) & mask;
+		if (state->index[slot] == 0U) {
+			break;
+		}
+
+		home = (size_t)spmc_shmem_obj_at(state,
+				state->index[slot] - 1U)->desc.handle & mask;
+
+		/* Move the entry unless its home lies after the hole */
+		if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+			state->index[hole] = state->index[slot];
+			hole = slot;
+		}
+	}
+
+	state->index[hole] = 0U;
+	state->index_used--;
+}
+
 /**
  * spmc_shmem_obj_free - Free struct spmc_shmem_obj.
  * @state:      Global state.
  * @obj:        Object to free.
  *
- * Release memory used by @obj. Other objects may move, so on return all
- * pointers to struct spmc_shmem_obj object should be considered invalid, not
- * just @obj.
- *
- * The current implementation always compacts the remaining objects to simplify
- * the allocator and to avoid fragmentation.
+ * Release memory used by @obj. The block is merged with the free blocks that
+ * follow it, other objects do not move.
  */
 
 static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 				  struct spmc_shmem_obj *obj)
 {
-	size_t free_size = spmc_shmem_obj_size(obj->desc_size);
-	uint8_t *shift_dest = (uint8_t *)obj;
-	uint8_t *shift_src = shift_dest + free_size;
-	size_t shift_size = state->allocated - (shift_src - state->data);
-
-	if (shift_size != 0U) {
-		memmove(shift_dest, shift_src, shift_size);
-	}
-	state->allocated -= free_size;
+	spmc_shmem_index_remove(state, obj);
+	obj->free = true;
+	spmc_shmem_obj_merge_free(state, obj);
 }
 
 /**
@@ -148,17 +350,12 @@ static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 static struct spmc_shmem_obj *
 spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 {
-	uint8_t *curr = state->data;
-
-	while (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+	size_t slot = spmc_shmem_index_find(state, handle);
 
-		if (obj->desc.handle == handle) {
-			return obj;
-		}
-		curr += spmc_shmem_obj_size(obj->desc_size);
+	if (state->index[slot] == 0U) {
+		return NULL;
 	}
-	return NULL;
+	return spmc_shmem_obj_at(state, state->index[slot] - 1U);
 }
 
 /**
@@ -173,14 +370,14 @@ spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 static struct spmc_shmem_obj *
 spmc_shmem_obj_get_next(struct spmc_shmem_obj_state *state, size_t *offset)
 {
-	uint8_t *curr = state->data + *offset;
-
-	if (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+	while (*offset < state->allocated) {
+		struct spmc_shmem_obj *obj = spmc_shmem_obj_at(state, *offset);
 
-		*offset += spmc_shmem_obj_size(obj->desc_size);
+		*offset += obj->block_size;
 
-		return obj;
+		if (!obj->free) {
+			return obj;
+		}
 	}
 	return NULL;
 }
@@ -568,7 +765,8 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
 		memcpy(&emad_array_out[i], emad_in,
 		       sizeof(struct ffa_emad_v1_0));
 
-		emad_in +=  mtd_orig->emad_size;
+		emad_in = (struct ffa_emad_v1_0 *)
+			  ((uint8_t *)emad_in + mtd_orig->emad_size);
 	}
 
 	/* Place the mrd descriptors after the end of the emad descriptors. */
@@ -601,7 +799,8 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
 		emad_array_out[i].comp_mrd_offset = emad_in->comp_mrd_offset +
 						    (mrd_out_offset -
 						     mrd_in_offset);
-		emad_in +=  mtd_orig->emad_size;
+		emad_in = (struct ffa_emad_v1_0 *)
+			  ((uint8_t *)emad_in + mtd_orig->emad_size);
 	}
 
 	/* Verify that we stay within bound of the memory descriptors. */
@@ -632,8 +831,6 @@ spmc_shm_convert_mtd_to_v1_0(struct spmc_shmem_obj *out_obj,
  *                  descriptor.
  *
  * Return: 0 if conversion and population succeeded.
- * Note: This function invalidates the reference to @orig therefore
- * `spmc_shmem_obj_lookup` must be called if further usage is required.
  */
 static uint32_t
 spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
@@ -669,11 +866,7 @@ spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
 		*copy_size = MIN(v1_0_obj->desc_size - offset, buf_size);
 		memcpy(dst, (uint8_t *) &v1_0_obj->desc + offset, *copy_size);
 
-		/*
-		 * We're finished with the v1.0 descriptor for now so free it.
-		 * Note that this will invalidate any references to the v1.1
-		 * descriptor.
-		 */
+		/* We're finished with the v1.0 descriptor for now so free it. */
 		spmc_shmem_obj_free(&spmc_shmem_obj_state, v1_0_obj);
 
 		return 0;
@@ -980,7 +1173,7 @@ static int spmc_shmem_check_state_obj(struct spmc_shmem_obj *obj,
 		 * transmitted descriptors.
 		 */
 		if ((obj->desc.handle != inflight_obj->desc.handle) &&
-		    (obj->desc_size == obj->desc_filled)) {
+		    (inflight_obj->desc_size == inflight_obj->desc_filled)) {
 			other_mrd = spmc_shmem_obj_get_comp_mrd(inflight_obj,
 							  FFA_VERSION_COMPILED);
 			if (other_mrd == NULL) {
@@ -1070,6 +1263,11 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		obj->desc.handle = spmc_shmem_obj_state.next_handle++;
 		obj->desc.flags |= mtd_flag;
+
+		if (!spmc_shmem_index_add(&spmc_shmem_obj_state, obj)) {
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_arg;
+		}
 	}
 
 	obj->desc_filled += fragment_length;
@@ -1102,7 +1300,6 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 	 */
 	if (ffa_version == MAKE_FFA_VERSION(1, 0)) {
 		struct spmc_shmem_obj *v1_1_obj;
-		uint64_t mem_handle;
 
 		/* Calculate the size that the v1.1 descriptor will required. */
 		uint64_t v1_1_desc_size =
@@ -1134,16 +1331,14 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 
 		/*
 		 * We're finished with the v1.0 descriptor so free it
-		 * and continue our checks with the new v1.1 descriptor.
+		 * and continue our checks with the new v1.1 descriptor,
+		 * which takes its place in the index.
 		 */
-		mem_handle = obj->desc.handle;
 		spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
-		obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
-		if (obj == NULL) {
-			ERROR("%s: Failed to find converted descriptor.\n",
-			     __func__);
-			ret = FFA_ERROR_INVALID_PARAMETER;
-			return spmc_ffa_error_return(smc_handle, ret);
+		obj = v1_1_obj;
+		if (!spmc_shmem_index_add(&spmc_shmem_obj_state, obj)) {
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_arg;
 		}
 	}
 
@@ -1588,12 +1783,6 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 		}
 	}
 
-	mbox->state = MAILBOX_STATE_FULL;
-
-	if (req->emad_count != 0U) {
-		obj->in_use++;
-	}
-
 	/*
 	 * If the caller is v1.0 convert the descriptor, otherwise copy
 	 * directly.
@@ -1613,6 +1802,13 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 		memcpy(resp, &obj->desc, copy_size);
 	}
 
+	/* Only a successful retrieval fills the RX buffer and uses the object */
+	mbox->state = MAILBOX_STATE_FULL;
+
+	if (req->emad_count != 0U) {
+		obj->in_use++;
+	}
+
 	/* Set the NS bit in the response if applicable. */
 	spmc_ffa_mem_retrieve_set_ns_bit(resp, sp_ctx);
 
@@ -1711,8 +1907,6 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 
 	buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
 
-	mbox->state = MAILBOX_STATE_FULL;
-
 	/*
 	 * If the caller is v1.0 convert the descriptor, otherwise copy
 	 * directly.
@@ -1738,6 +1932,8 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 		memcpy(mbox->rx_buffer, src + fragment_offset, copy_size);
 	}
 
+	mbox->state = MAILBOX_STATE_FULL;
+
 	spin_unlock(&mbox->lock);
 	spin_unlock(&spmc_shmem_obj_state.lock);
 
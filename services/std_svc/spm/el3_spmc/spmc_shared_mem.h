@@ -37,6 +37,8 @@ CASSERT(sizeof(struct ffa_mem_relinquish_descriptor) == 16,
  * @data_size:      The size allocated for the backing store.
  * @allocated:      Number of bytes allocated in @data.
  * @next_handle:    Handle used for next allocated object.
+ * @index:          Open addressing table of the objects by handle.
+ * @index_used:     Number of objects in @index.
  * @lock:           Lock protecting all state in this file.
  */
 struct spmc_shmem_obj_state {
@@ -44,6 +46,8 @@ struct spmc_shmem_obj_state {
 	size_t data_size;
 	size_t allocated;
 	uint64_t next_handle;
+	uint32_t *index;
+	size_t index_used;
 	spinlock_t lock;
 };
 
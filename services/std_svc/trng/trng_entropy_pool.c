@@ -5,10 +5,13 @@
  */
 
 #include <assert.h>
+#include <cdefs.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <lib/spinlock.h>
 #include <plat/common/plat_trng.h>
+#include <plat/common/platform.h>
+#include <platform_def.h>
 
 /*
  * # Entropy pool
@@ -17,45 +20,108 @@
  * so that when we have 1-63 bits in the pool, and we have a request for
  * 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
  * entropy.
+ *
+ * With TRNG_PER_CPU_POOL, every CPU owns a larger pool that is only ever
+ * touched by that CPU, so no lock is needed. The pool is refilled in bulk
+ * once it runs dry, which lets the platform amortise the cost of reaching
+ * the entropy source over several requests.
  */
+#if TRNG_PER_CPU_POOL
+#define WORDS_IN_POOL	(8)
+#define TRNG_POOL_COUNT	PLATFORM_CORE_COUNT
+#else
 #define WORDS_IN_POOL	(4)
-static uint64_t entropy[WORDS_IN_POOL];
-/* index in bits of the first bit of usable entropy */
-static uint32_t entropy_bit_index;
-/* then number of valid bits in the entropy pool */
-static uint32_t entropy_bit_size;
+#define TRNG_POOL_COUNT	1
+#endif
+
+struct trng_pool {
+	uint64_t entropy[WORDS_IN_POOL];
+	/* index in bits of the first bit of usable entropy */
+	uint32_t entropy_bit_index;
+	/* then number of valid bits in the entropy pool */
+	uint32_t entropy_bit_size;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct trng_pool trng_pools[TRNG_POOL_COUNT];
 
+#if !TRNG_PER_CPU_POOL
 static spinlock_t trng_pool_lock;
+#endif
 
-#define BITS_PER_WORD		(sizeof(entropy[0]) * 8)
+#define BITS_PER_WORD		(sizeof(uint64_t) * 8)
 #define BITS_IN_POOL		(WORDS_IN_POOL * BITS_PER_WORD)
-#define ENTROPY_MIN_WORD	(entropy_bit_index / BITS_PER_WORD)
-#define ENTROPY_FREE_BIT	(entropy_bit_size + entropy_bit_index)
+#define ENTROPY_MIN_WORD	(pool->entropy_bit_index / BITS_PER_WORD)
+#define ENTROPY_FREE_BIT	(pool->entropy_bit_size + pool->entropy_bit_index)
 #define _ENTROPY_FREE_WORD	(ENTROPY_FREE_BIT / BITS_PER_WORD)
 #define ENTROPY_FREE_INDEX	(_ENTROPY_FREE_WORD % WORDS_IN_POOL)
 /* ENTROPY_WORD_INDEX(0) includes leftover bits in the lower bits */
 #define ENTROPY_WORD_INDEX(i)	((ENTROPY_MIN_WORD + i) % WORDS_IN_POOL)
 
+/*
+ * Default bulk entropy source, for platforms that only provide
+ * plat_get_entropy(). Returns the number of words written to out.
+ */
+#pragma weak plat_get_entropy_bulk
+unsigned int plat_get_entropy_bulk(uint64_t *out, unsigned int nwords)
+{
+	unsigned int i;
+
+	for (i = 0; i < nwords; i++) {
+		if (!plat_get_entropy(&out[i])) {
+			break;
+		}
+	}
+
+	return i;
+}
+
 /*
  * Fill the entropy pool until we have at least as many bits as requested.
  * Returns true after filling the pool, and false if the entropy source is out
  * of entropy and the pool could not be filled.
  * Assumes locks are taken.
  */
-static bool trng_fill_entropy(uint32_t nbits)
+#if TRNG_PER_CPU_POOL
+static bool trng_fill_entropy(struct trng_pool *pool, uint32_t nbits)
 {
-	while (nbits > entropy_bit_size) {
-		bool valid = plat_get_entropy(&entropy[ENTROPY_FREE_INDEX]);
+	uint64_t words[WORDS_IN_POOL];
+	unsigned int i, free_words, got;
+
+	if (nbits <= pool->entropy_bit_size) {
+		return true;
+	}
+
+	/*
+	 * Top the pool up completely. A partially consumed word still holds
+	 * leftover bits and is not refilled.
+	 */
+	free_words = (BITS_IN_POOL - pool->entropy_bit_size) / BITS_PER_WORD;
+	got = plat_get_entropy_bulk(words, free_words);
+
+	for (i = 0; i < got; i++) {
+		pool->entropy[ENTROPY_FREE_INDEX] = words[i];
+		pool->entropy_bit_size += BITS_PER_WORD;
+		assert(pool->entropy_bit_size <= BITS_IN_POOL);
+	}
+
+	return nbits <= pool->entropy_bit_size;
+}
+#else
+static bool trng_fill_entropy(struct trng_pool *pool, uint32_t nbits)
+{
+	while (nbits > pool->entropy_bit_size) {
+		bool valid = plat_get_entropy(&pool->entropy[ENTROPY_FREE_INDEX]);
 
 		if (valid) {
-			entropy_bit_size += BITS_PER_WORD;
-			assert(entropy_bit_size <= BITS_IN_POOL);
+			pool->entropy_bit_size += BITS_PER_WORD;
+			assert(pool->entropy_bit_size <= BITS_IN_POOL);
 		} else {
 			return false;
 		}
 	}
 	return true;
 }
+#endif
 
 /*
  * Pack entropy into the out buffer, filling and taking locks as needed.
@@ -67,14 +133,20 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 {
 	bool ret = true;
 	uint32_t bits_to_discard = nbits;
+#if TRNG_PER_CPU_POOL
+	struct trng_pool *pool = &trng_pools[plat_my_core_pos()];
+#else
+	struct trng_pool *pool = &trng_pools[0];
+
 	spin_lock(&trng_pool_lock);
+#endif
 
-	if (!trng_fill_entropy(nbits)) {
+	if (!trng_fill_entropy(pool, nbits)) {
 		ret = false;
 		goto out;
 	}
 
-	const unsigned int rshift = entropy_bit_index % BITS_PER_WORD;
+	const unsigned int rshift = pool->entropy_bit_index % BITS_PER_WORD;
 	const unsigned int lshift = BITS_PER_WORD - rshift;
 	const int to_fill = ((nbits + BITS_PER_WORD - 1) / BITS_PER_WORD);
 	int word_i;
@@ -111,7 +183,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 *                   5 4 3 2 1 0 7 6
 		 *                  [e,e,e,e,e,e,e,e]
 		 */
-		out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
+		out[word_i] |= pool->entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
 
 		/**
 		 * Discarding the used/packed entropy bits from the respective
@@ -156,7 +228,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * amount of bits only.
 		 */
 		if (bits_to_discard < (BITS_PER_WORD - rshift)) {
-			entropy[ENTROPY_WORD_INDEX(word_i)] &=
+			pool->entropy[ENTROPY_WORD_INDEX(word_i)] &=
 			(~0ULL << ((bits_to_discard+rshift) % BITS_PER_WORD));
 			bits_to_discard = 0;
 		} else {
@@ -167,7 +239,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * will be already zeros from previous operations, and the
 		 * bits_to_discard is updated precisely.
 		 */
-			entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
+			pool->entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
 			bits_to_discard -= (BITS_PER_WORD - rshift);
 		}
 
@@ -178,7 +250,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * the `|=` operation.
 		 */
 		if (lshift != BITS_PER_WORD) {
-			out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i + 1)]
+			out[word_i] |= pool->entropy[ENTROPY_WORD_INDEX(word_i + 1)]
 				<< lshift;
 			/**
 			 * Discarding the remaining packed bits from upperword
@@ -191,7 +263,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * amount of bits only.
 			 */
 			if (bits_to_discard < (BITS_PER_WORD - lshift)) {
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
 				(~0ULL << ((bits_to_discard) % BITS_PER_WORD));
 				bits_to_discard = 0;
 			} else {
@@ -204,7 +276,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * there are still some unused valid entropy bits at the
 			 * upper end for future use.
 			 */
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
 				(~0ULL << ((BITS_PER_WORD - lshift) % BITS_PER_WORD));
 				bits_to_discard -= (BITS_PER_WORD - lshift);
 		}
@@ -215,22 +287,27 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 
 	out[to_fill - 1] &= mask;
 
-	entropy_bit_index = (entropy_bit_index + nbits) % BITS_IN_POOL;
-	entropy_bit_size -= nbits;
+	pool->entropy_bit_index = (pool->entropy_bit_index + nbits) %
+				  BITS_IN_POOL;
+	pool->entropy_bit_size -= nbits;
 
 out:
+#if !TRNG_PER_CPU_POOL
 	spin_unlock(&trng_pool_lock);
+#endif
 
 	return ret;
 }
 
 void trng_entropy_pool_setup(void)
 {
-	int i;
+	unsigned int i, j;
 
-	for (i = 0; i < WORDS_IN_POOL; i++) {
-		entropy[i] = 0;
+	for (i = 0; i < TRNG_POOL_COUNT; i++) {
+		for (j = 0; j < WORDS_IN_POOL; j++) {
+			trng_pools[i].entropy[j] = 0;
+		}
+		trng_pools[i].entropy_bit_index = 0;
+		trng_pools[i].entropy_bit_size = 0;
 	}
-	entropy_bit_index = 0;
-	entropy_bit_size = 0;
 }
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Decode the boot profile entry (TL_TAG_BOOT_PROFILE) of a transfer list, as
+# built by BL31 with BOOT_TIME_INSTRUMENTATION=1. The input is a dump of the
+# transfer list, or of the entry data only (--raw). The layout is described
+# in include/lib/boot_profile.h.
+#
+# Profiles can be saved with --json and compared against a previous release
+# with --compare, to track boot time regressions.
+#
+
+import argparse
+import json
+import struct
+import sys
+
+TL_SIGNATURE = 0x006ed0ff
+TL_GRANULE = 8
+TL_TAG_BOOT_PROFILE = 0xfff000
+
+BOOT_PROFILE_VERSION = 1
+
+# include/lib/boot_time.h
+STAGES = {
+	0: "bl2_entry",
+	1: "storage_init_start",
+	2: "storage_init_end",
+	3: "gpt_parse_start",
+	4: "gpt_parse_end",
+	5: "bl2_exit",
+	6: "bl31_entry",
+	7: "bl31_exit",
+}
+
+# include/lib/boot_profile.h
+BACKENDS = ["mmc", "nand", "nor", "other"]
+
+# include/export/common/tbbr/tbbr_img_def_exp.h
+IMAGES = {
+	1: "BL2", 2: "SCP_BL2", 3: "BL31", 4: "BL32", 5: "BL33",
+	6: "TRUSTED_BOOT_FW_CERT", 7: "TRUSTED_KEY_CERT",
+	8: "SCP_FW_KEY_CERT", 9: "SOC_FW_KEY_CERT",
+	10: "TRUSTED_OS_FW_KEY_CERT", 11: "NON_TRUSTED_FW_KEY_CERT",
+	12: "SCP_FW_CONTENT_CERT", 13: "SOC_FW_CONTENT_CERT",
+	14: "TRUSTED_OS_FW_CONTENT_CERT", 15: "NON_TRUSTED_FW_CONTENT_CERT",
+	21: "BL32_EXTRA1", 22: "BL32_EXTRA2", 23: "HW_CONFIG",
+	24: "TB_FW_CONFIG", 25: "SOC_FW_CONFIG", 26: "TOS_FW_CONFIG",
+	27: "NT_FW_CONFIG", 28: "GPT", 31: "FW_CONFIG", 34: "RMM",
+}
+
+HDR = struct.Struct("<IIQIIII")
+IO = struct.Struct("<QIIII")
+IMAGE = struct.Struct("<IIQQQQ")
+
+def find_entry(data):
+	sig, _, _, hdr_size, _, size, _ = struct.unpack_from("<IBBBBII", data)
+	if sig != TL_SIGNATURE:
+		sys.exit("not a transfer list (signature 0x%08x)" % sig)
+
+	size = min(size, len(data))
+	off = hdr_size
+	while off + 8 <= size:
+		tag, tag_hi, te_hdr_size, data_size = \
+			struct.unpack_from("<HBBI", data, off)
+		tag |= tag_hi << 16
+		start = off + te_hdr_size
+		if tag == TL_TAG_BOOT_PROFILE:
+			return data[start:start + data_size]
+
+		off = (start + data_size + TL_GRANULE - 1) & ~(TL_GRANULE - 1)
+
+	sys.exit("no boot profile entry in the transfer list")
+
+def decode(data):
+	if len(data) < HDR.size:
+		sys.exit("boot profile truncated")
+
+	version, size, cntfrq, num_stages, num_io, num_images, _ = \
+		HDR.unpack_from(data)
+	if version != BOOT_PROFILE_VERSION:
+		sys.exit("unsupported boot profile version %d" % version)
+
+	if size > len(data) or cntfrq == 0:
+		sys.exit("invalid boot profile")
+
+	def us(ticks):
+		return ticks * 1000000 // cntfrq
+
+	off = HDR.size
+	stages = struct.unpack_from("<%dQ" % num_stages, data, off)
+	off += 8 * num_stages
+
+	prof = { "stages": {}, "io": {}, "images": {} }
+
+	for i, ts in enumerate(stages):
+		if ts:
+			prof["stages"][STAGES.get(i, "stage%d" % i)] = us(ts)
+
+	for i in range(num_io):
+		nbytes, retries, corrected, failed, _ = IO.unpack_from(data, off)
+		off += IO.size
+		if nbytes or retries or corrected or failed:
+			name = BACKENDS[i] if i < len(BACKENDS) else "io%d" % i
+			prof["io"][name] = { "bytes": nbytes, "retries": retries,
+					     "ecc_corrected": corrected,
+					     "ecc_failed": failed }
+
+	for i in range(num_images):
+		image_id, _, nbytes, load, auth, decomp = \
+			IMAGE.unpack_from(data, off)
+		off += IMAGE.size
+		prof["images"][IMAGES.get(image_id, "image%d" % image_id)] = {
+			"bytes": nbytes, "load_us": us(load),
+			"auth_us": us(auth), "decomp_us": us(decomp) }
+
+	return prof
+
+def delta(new, old):
+	if old is None:
+		return ""
+
+	return " (%+d)" % (new - old)
+
+def show(prof, ref):
+	ref_stages = ref.get("stages", {}) if ref else {}
+	ref_io = ref.get("io", {}) if ref else {}
+	ref_images = ref.get("images", {}) if ref else {}
+
+	print("Stages (us since counter start):")
+	for name, t in prof["stages"].items():
+		print("  %-20s %10d%s" % (name, t, delta(t, ref_stages.get(name))))
+
+	print("Storage:")
+	for name, io in prof["io"].items():
+		old = ref_io.get(name, {})
+		print("  %-6s %10d bytes%s, %d retries, %d bitflips corrected, "
+		      "%d uncorrectable pages" %
+		      (name, io["bytes"], delta(io["bytes"], old.get("bytes")),
+		       io["retries"], io["ecc_corrected"], io["ecc_failed"]))
+
+	print("Images (us):")
+	print("  %-28s %10s %10s %10s %10s" %
+	      ("", "bytes", "load", "auth", "decomp"))
+	for name, img in prof["images"].items():
+		old = ref_images.get(name, {})
+		print("  %-28s %10d %10d %10d %10d%s" %
+		      (name, img["bytes"], img["load_us"], img["auth_us"],
+		       img["decomp_us"],
+		       delta(img["load_us"] + img["auth_us"] + img["decomp_us"],
+			     old.get("load_us", 0) + old.get("auth_us", 0) +
+			     old.get("decomp_us", 0) if old else None)))
+
+def main():
+	parser = argparse.ArgumentParser(description="Decode a boot profile")
+	parser.add_argument("--raw", action="store_true",
+			    help="input is the entry data, not a transfer list")
+	parser.add_argument("--json", metavar="FILE",
+			    help="save the decoded profile as JSON")
+	parser.add_argument("--compare", metavar="FILE",
+			    help="show differences to a profile saved by --json")
+	parser.add_argument("input")
+	args = parser.parse_args()
+
+	with open(args.input, "rb") as f:
+		data = f.read()
+
+	if not args.raw:
+		data = find_entry(data)
+
+	prof = decode(data)
+
+	ref = None
+	if args.compare:
+		with open(args.compare) as f:
+			ref = json.load(f)
+
+	show(prof, ref)
+
+	if args.json:
+		with open(args.json, "w") as f:
+			json.dump(prof, f, indent=1)
+
+if __name__ == "__main__":
+	main()
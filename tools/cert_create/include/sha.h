@@ -8,5 +8,7 @@
 #define SHA_H
 
 int sha_file(int md_alg, const char *filename, unsigned char *md);
+int sha_file_chunked(int md_alg, const char *filename,
+		     unsigned int chunk_size, unsigned char *md);
 
 #endif /* SHA_H */
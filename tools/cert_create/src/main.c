@@ -61,6 +61,7 @@
 /* Global options */
 static int key_alg;
 static int hash_alg;
+static unsigned int hash_chunk_size;
 static int key_size;
 static int new_keys;
 static int save_keys;
@@ -280,6 +281,11 @@ static const cmd_opt_t common_cmd_opt[] = {
 		{ "hash-alg", required_argument, NULL, 's' },
 		"Hash algorithm : 'sha256' (default), 'sha384', 'sha512'"
 	},
+	{
+		{ "hash-chunk-size", required_argument, NULL, 'c' },
+		"Hash images as a list of SHA-256 digests of chunks of this " \
+		"size (in bytes)"
+	},
 	{
 		{ "save-keys", no_argument, NULL, 'k' },
 		"Save key pairs into files. Filenames must be provided"
@@ -347,7 +353,7 @@ int main(int argc, char *argv[])
 
 	while (1) {
 		/* getopt_long stores the option index here. */
-		c = getopt_long(argc, argv, "a:b:hknps:", cmd_opt, &opt_idx);
+		c = getopt_long(argc, argv, "a:b:c:hknps:", cmd_opt, &opt_idx);
 
 		/* Detect the end of the options. */
 		if (c == -1) {
@@ -369,6 +375,13 @@ int main(int argc, char *argv[])
 				exit(1);
 			}
 			break;
+		case 'c':
+			hash_chunk_size = strtoul(optarg, NULL, 0);
+			if (hash_chunk_size == 0) {
+				ERROR("Invalid hash chunk size '%s'\n", optarg);
+				exit(1);
+			}
+			break;
 		case 'h':
 			print_help(argv[0], cmd_opt);
 			exit(0);
@@ -524,7 +537,8 @@ int main(int argc, char *argv[])
 					}
 				} else {
 					/* Calculate the hash of the file */
-					if (!sha_file(hash_alg, ext->arg, md)) {
+					if (!sha_file_chunked(hash_alg, ext->arg,
+							      hash_chunk_size, md)) {
 						ERROR("Cannot calculate hash of %s\n",
 							ext->arg);
 						exit(1);
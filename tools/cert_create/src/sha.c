@@ -4,15 +4,17 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include "debug.h"
 #include "key.h"
-#if USING_OPENSSL3
+#include <tbb_hash_chunk.h>
 #include <openssl/evp.h>
+#if USING_OPENSSL3
 #include <openssl/obj_mac.h>
-#else
-#include <openssl/sha.h>
 #endif
+#include <openssl/sha.h>
 
 #define BUFFER_SIZE	256
 
@@ -116,3 +118,98 @@ err:
 #endif
 }
 
+static const EVP_MD *get_md(int md_alg)
+{
+	if (md_alg == HASH_ALG_SHA384) {
+		return EVP_sha384();
+	} else if (md_alg == HASH_ALG_SHA512) {
+		return EVP_sha512();
+	}
+
+	return EVP_sha256();
+}
+
+/*
+ * Hash a file as a list of chunk digests: every 'chunk_size' bytes of the
+ * file are hashed with SHA-256, and 'md' is the 'md_alg' hash of the header
+ * described in tbb_hash_chunk.h followed by the chunk digests. Files of any
+ * size are hashed this way; only a 'chunk_size' of 0 hashes the file as a
+ * whole, as done by sha_file().
+ */
+int sha_file_chunked(int md_alg, const char *filename,
+		     unsigned int chunk_size, unsigned char *md)
+{
+	FILE *inFile;
+	unsigned char *chunk = NULL, *list = NULL, *tmp;
+	size_t bytes, list_len = 0;
+	long size;
+	int ret = 0;
+
+	if (chunk_size == 0) {
+		return sha_file(md_alg, filename, md);
+	}
+
+	if ((filename == NULL) || (md == NULL)) {
+		ERROR("%s(): NULL argument\n", __func__);
+		return 0;
+	}
+
+	inFile = fopen(filename, "rb");
+	if (inFile == NULL) {
+		ERROR("Cannot read %s\n", filename);
+		return 0;
+	}
+
+	if ((fseek(inFile, 0, SEEK_END) != 0) ||
+	    ((size = ftell(inFile)) < 0) ||
+	    (fseek(inFile, 0, SEEK_SET) != 0)) {
+		ERROR("Cannot get size of %s\n", filename);
+		fclose(inFile);
+		return 0;
+	}
+
+	if ((unsigned long)size > UINT32_MAX) {
+		ERROR("%s is too large for a chunked hash\n", filename);
+		fclose(inFile);
+		return 0;
+	}
+
+	chunk = malloc(chunk_size);
+	list = malloc(TBB_HASH_CHUNK_HDR_SIZE);
+	if ((chunk == NULL) || (list == NULL)) {
+		ERROR("%s(): Cannot allocate chunk buffer\n", __func__);
+		goto err;
+	}
+
+	tbb_hash_chunk_hdr(list, chunk_size, (uint32_t)size);
+	list_len = TBB_HASH_CHUNK_HDR_SIZE;
+
+	while ((bytes = fread(chunk, 1, chunk_size, inFile)) != 0) {
+		tmp = realloc(list, list_len + TBB_HASH_CHUNK_DIGEST_SIZE);
+		if (tmp == NULL) {
+			ERROR("%s(): Cannot allocate digest list\n", __func__);
+			goto err;
+		}
+		list = tmp;
+
+		if (!EVP_Digest(chunk, bytes, list + list_len, NULL,
+				EVP_sha256(), NULL)) {
+			ERROR("%s(): Cannot hash chunk\n", __func__);
+			goto err;
+		}
+		list_len += TBB_HASH_CHUNK_DIGEST_SIZE;
+	}
+
+	if (!EVP_Digest(list, list_len, md, NULL, get_md(md_alg), NULL)) {
+		ERROR("%s(): Cannot hash digest list\n", __func__);
+		goto err;
+	}
+
+	ret = 1;
+
+err:
+	free(list);
+	free(chunk);
+	fclose(inFile);
+	return ret;
+}
@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Decode the binary log trace recorded by an image built with
+# LOG_BINARY_LEVEL, see common/tf_log.c. The input is a dump of the memory
+# holding the tf_log_rings array of the image, taken with a debugger or by a
+# later boot stage. The format strings are read from the ELF file of the image.
+#
+# Messages of all CPUs are printed in the order they were logged.
+#
+
+import argparse
+import struct
+import sys
+
+TF_LOG_BIN_MAGIC = 0x474f4c42
+MAX_ARGS = 6
+# The log level is in the top byte of the format string address
+LEVEL_SHIFT = 56
+
+RING_HDR = struct.Struct("<IIQ")
+RECORD = struct.Struct("<QQ%dQ" % MAX_ARGS)
+
+LEVELS = { 10: "ERROR", 20: "NOTICE", 30: "WARNING", 40: "INFO",
+	   50: "VERBOSE" }
+
+SHF_ALLOC = 0x2
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+
+class Elf:
+	def __init__(self, path):
+		with open(path, "rb") as f:
+			self.data = f.read()
+
+		if self.data[:4] != b"\x7fELF" or self.data[5] != 1:
+			sys.exit("%s: not a little-endian ELF file" % path)
+
+		self.is64 = self.data[4] == 2
+		if self.is64:
+			shoff, = struct.unpack_from("<Q", self.data, 0x28)
+			shentsize, shnum = struct.unpack_from("<HH", self.data, 0x3a)
+			shdr = "<IIQQQQIIQQ"
+		else:
+			shoff, = struct.unpack_from("<I", self.data, 0x20)
+			shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2e)
+			shdr = "<IIIIIIIIII"
+
+		self.sections = []
+		for i in range(shnum):
+			(_, sh_type, flags, addr, offset, size, link, _, _,
+			 entsize) = struct.unpack_from(shdr, self.data,
+						       shoff + i * shentsize)
+			self.sections.append((sh_type, flags, addr, offset, size,
+					      link, entsize))
+
+	def symbol(self, name):
+		for sh_type, _, _, offset, size, link, entsize in self.sections:
+			if sh_type != SHT_SYMTAB:
+				continue
+
+			strtab = self.sections[link][3]
+			for off in range(offset, offset + size, entsize):
+				if self.is64:
+					st_name, _, _, _, value, sym_size = \
+						struct.unpack_from("<IBBHQQ",
+								   self.data, off)
+				else:
+					st_name, value, sym_size = \
+						struct.unpack_from("<III",
+								   self.data, off)
+
+				start = strtab + st_name
+				end = self.data.index(b"\0", start)
+				if self.data[start:end] == name.encode():
+					return value, sym_size
+
+		sys.exit("symbol %s not found, is LOG_BINARY_LEVEL set?" % name)
+
+	def string(self, addr):
+		for sh_type, flags, base, offset, size, _, _ in self.sections:
+			if (not flags & SHF_ALLOC or sh_type == SHT_NOBITS or
+			    not base <= addr < base + size):
+				continue
+
+			start = offset + addr - base
+			end = self.data.index(b"\0", start)
+			return self.data[start:end].decode(errors="replace")
+
+		return None
+
+# Format a message the way lib/libc/printf.c would
+def format_msg(elf, fmt, args):
+	out = ""
+	args = list(args)
+	i = 0
+	while i < len(fmt):
+		c = fmt[i]
+		i += 1
+		if c != "%":
+			out += c
+			continue
+
+		pad = ""
+		while i < len(fmt) and fmt[i] in "0123456789lz":
+			if fmt[i].isdigit():
+				pad += fmt[i]
+			i += 1
+
+		conv = fmt[i] if i < len(fmt) else ""
+		i += 1
+		if conv == "%":
+			out += "%"
+			continue
+
+		if conv not in "idcspxXu" or conv == "":
+			break
+
+		if not args:
+			out += "<?>"
+			continue
+
+		arg = args.pop(0)
+		if conv in "id":
+			if arg >= 1 << 63:
+				arg -= 1 << 64
+			out += ("%" + pad + "d") % arg
+		elif conv in "uxX":
+			out += ("%" + pad + {"u": "d"}.get(conv, conv)) % arg
+		elif conv == "p":
+			out += "0x%x" % arg if arg else "0"
+		elif conv == "c":
+			out += chr(arg & 0xff)
+		else:
+			s = elf.string(arg)
+			out += s if s is not None else "<0x%x>" % arg
+
+	return out
+
+# Size of the ring of a CPU, found from one which has been written to
+def ring_size(dump):
+	records = 1
+	while RING_HDR.size + records * RECORD.size <= len(dump):
+		size = RING_HDR.size + records * RECORD.size
+		if len(dump) % size == 0:
+			for off in range(0, len(dump), size):
+				magic, n, _ = RING_HDR.unpack_from(dump, off)
+				if magic == TF_LOG_BIN_MAGIC and n == records:
+					return size
+
+		records *= 2
+
+	sys.exit("nothing logged")
+
+def decode(elf, dump, cntfrq):
+	size = ring_size(dump)
+	msgs = []
+	for cpu, off in enumerate(range(0, len(dump), size)):
+		magic, records, count = RING_HDR.unpack_from(dump, off)
+		if magic != TF_LOG_BIN_MAGIC:
+			continue
+
+		first = max(count - records, 0)
+		for n in range(first, count):
+			rec = RECORD.unpack_from(dump, off + RING_HDR.size +
+						 (n % records) * RECORD.size)
+			msgs.append((rec[1], cpu, rec[0], rec[2:]))
+
+	for ts, cpu, fmt_addr, args in sorted(msgs):
+		level = LEVELS.get(fmt_addr >> LEVEL_SHIFT, "?")
+		fmt_addr &= (1 << LEVEL_SHIFT) - 1
+		fmt = elf.string(fmt_addr)
+		if fmt is None:
+			line = "<unknown format 0x%x>\n" % fmt_addr
+		else:
+			line = format_msg(elf, fmt, args)
+
+		stamp = "%d us" % (ts * 1000000 // cntfrq) if cntfrq else ts
+		sys.stdout.write("[%s] cpu%d %s: %s" % (stamp, cpu, level, line))
+		if not line.endswith("\n"):
+			sys.stdout.write("\n")
+
+def main():
+	parser = argparse.ArgumentParser(description="Decode a binary log")
+	parser.add_argument("--elf", required=True,
+			    help="ELF file of the image which logged the trace")
+	parser.add_argument("--base", type=lambda x: int(x, 0),
+			    help="address the dump starts at (default: "
+				 "the address of tf_log_rings)")
+	parser.add_argument("--cntfrq", type=lambda x: int(x, 0),
+			    help="counter frequency, to show times in us")
+	parser.add_argument("dump")
+	args = parser.parse_args()
+
+	elf = Elf(args.elf)
+	addr, size = elf.symbol("tf_log_rings")
+
+	with open(args.dump, "rb") as f:
+		dump = f.read()
+
+	start = addr - args.base if args.base is not None else 0
+	if start < 0 or start + size > len(dump):
+		sys.exit("the dump does not cover tf_log_rings (0x%x, %d bytes)" %
+			 (addr, size))
+
+	decode(elf, dump[start:start + size], args.cntfrq)
+
+if __name__ == "__main__":
+	main()
@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, MediaTek Inc. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Compress an image into a chunked XZ container, which can be decompressed
+# by BL2 on several CPUs in parallel (BL33_XZ_DECOMP=1 BL2_MP=1).
+#
+# Layout (little-endian):
+#   u32 magic ("MXZC"), u32 num_chunks, u32 hdr_size, u32 reserved
+#   num_chunks * { u32 offset, u32 size, u32 out_offset, u32 out_size }
+#   XZ streams, each aligned to 16 bytes
+#
+# A chunk which XZ doesn't shrink is stored raw instead, with its size equal
+# to its output size, which BL2 copies without trying to decode it.
+#
+
+import argparse
+import lzma
+import struct
+import sys
+
+MAGIC = 0x435a584d
+MAX_CHUNKS = 64
+ALIGN = 16
+
+def align(n):
+	return (n + ALIGN - 1) & ~(ALIGN - 1)
+
+def compress(data, chunk_size, preset):
+	# xz-embedded in TF-A only verifies CRC32 checks
+	filters = [{ "id": lzma.FILTER_LZMA2, "preset": preset }]
+	chunks = []
+
+	for off in range(0, len(data), chunk_size):
+		raw = data[off:off + chunk_size]
+		xz = lzma.compress(raw, format=lzma.FORMAT_XZ,
+				   check=lzma.CHECK_CRC32, filters=filters)
+		# BL2 copies the chunks stored raw, which it tells apart from
+		# the XZ ones, always smaller, by their size
+		if len(xz) >= len(raw):
+			xz = raw
+		chunks.append((xz, off, len(raw)))
+
+	return chunks
+
+def main():
+	parser = argparse.ArgumentParser(description="Create chunked XZ image")
+	parser.add_argument("-s", "--chunk-size", type=lambda x: int(x, 0),
+			    default=0x40000, help="uncompressed chunk size")
+	parser.add_argument("-p", "--preset", type=int, default=6,
+			    help="LZMA2 preset (0-9)")
+	parser.add_argument("input")
+	parser.add_argument("output")
+	args = parser.parse_args()
+
+	with open(args.input, "rb") as f:
+		data = f.read()
+
+	if not data:
+		sys.exit("%s: empty input" % args.input)
+
+	chunks = compress(data, args.chunk_size, args.preset)
+	if len(chunks) > MAX_CHUNKS:
+		sys.exit("too many chunks (%d > %d), increase --chunk-size" %
+			 (len(chunks), MAX_CHUNKS))
+
+	hdr_size = align(16 + 16 * len(chunks))
+	table = b""
+	payload = b""
+	offset = hdr_size
+
+	for xz, out_offset, out_size in chunks:
+		table += struct.pack("<IIII", offset, len(xz), out_offset,
+				     out_size)
+		pad = align(len(xz)) - len(xz)
+		payload += xz + b"\0" * pad
+		offset += len(xz) + pad
+
+	hdr = struct.pack("<IIII", MAGIC, len(chunks), hdr_size, 0) + table
+	hdr += b"\0" * (hdr_size - len(hdr))
+
+	with open(args.output, "wb") as f:
+		f.write(hdr + payload)
+
+	print("%s: %d chunks, %d -> %d bytes" % (args.output, len(chunks),
+						 len(data), len(hdr) + len(payload)))
+
+if __name__ == "__main__":
+	main()